@@ -0,0 +1,254 @@
+#include "hypergeometric_batch.h"
+
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+
+#include <boost/math/special_functions/hypergeometric.hpp>
+#include <boost/math/tools/parallel.hpp>
+
+namespace
+{
+using namespace boost::math::policies;
+
+// every error is thrown and becomes the code of its point
+const policy<
+  underflow_error<ignore_error>,
+  denorm_error<ignore_error>
+      > pol;
+
+// points per thread below which another thread does not pay off
+const std::size_t grain = 256u;
+
+int error_code()
+{
+  try
+  {
+    throw;
+  }
+  catch (const std::domain_error&)
+  {
+    return hypergeometric_domain_error;
+  }
+  catch (const std::overflow_error&)
+  {
+    return hypergeometric_overflow_error;
+  }
+  catch (const boost::math::evaluation_error&)
+  {
+    return hypergeometric_evaluation_error;
+  }
+  catch (...)
+  {
+    return hypergeometric_other_error;
+  }
+}
+
+template <class T, unsigned N>
+struct strided_arguments
+{
+  const T* x[N];
+  std::ptrdiff_t stride[N];
+
+  T operator()(unsigned k, std::size_t i) const
+  {
+    return x[k][static_cast<std::ptrdiff_t>(i) * stride[k]];
+  }
+};
+
+template <class T, unsigned N, class Function>
+struct batch_task
+{
+  batch_task(const strided_arguments<T, N>& args, T* result, std::ptrdiff_t result_stride, int* errors):
+    args(args), result(result), result_stride(result_stride), errors(errors), failures(0u)
+  {
+  }
+
+  void operator()(std::size_t first, std::size_t last)
+  {
+    std::size_t failed = 0u;
+
+    for (std::size_t i = first; i < last; ++i)
+    {
+      T value;
+      int code = hypergeometric_ok;
+
+      try
+      {
+        value = Function()(args, i);
+      }
+      catch (...)
+      {
+        code = error_code();
+        value = std::numeric_limits<T>::quiet_NaN();
+        ++failed;
+      }
+
+      result[static_cast<std::ptrdiff_t>(i) * result_stride] = value;
+      if (errors)
+        errors[i] = code;
+    }
+
+    // chunks run concurrently, only the count is shared
+    failures += failed;
+  }
+
+  const strided_arguments<T, N>& args;
+  T* result;
+  const std::ptrdiff_t result_stride;
+  int* errors;
+  std::atomic<std::size_t> failures;
+};
+
+template <class T, unsigned N, class Function>
+std::size_t batch(const strided_arguments<T, N>& args, T* result, std::ptrdiff_t result_stride, std::size_t n, int* errors, unsigned threads)
+{
+  if (n == 0)
+    return 0u;
+
+  if (threads == 0)
+    threads = boost::math::tools::default_thread_count();
+  if (threads > (n + grain - 1) / grain)
+    threads = static_cast<unsigned>((n + grain - 1) / grain);
+
+  batch_task<T, N, Function> task(args, result, result_stride, errors);
+  boost::math::tools::parallel_for_chunks(n, threads, task);
+
+  return task.failures;
+}
+
+struct function_0f1
+{
+  template <class T>
+  T operator()(const strided_arguments<T, 2>& x, std::size_t i) const
+  {
+    return boost::math::hypergeometric_0f1(x(0, i), x(1, i), pol);
+  }
+};
+
+struct function_1f0
+{
+  template <class T>
+  T operator()(const strided_arguments<T, 2>& x, std::size_t i) const
+  {
+    return boost::math::hypergeometric_1f0(x(0, i), x(1, i), pol);
+  }
+};
+
+struct function_1f1
+{
+  template <class T>
+  T operator()(const strided_arguments<T, 3>& x, std::size_t i) const
+  {
+    return boost::math::hypergeometric_1f1(x(0, i), x(1, i), x(2, i), pol);
+  }
+};
+
+struct function_u
+{
+  template <class T>
+  T operator()(const strided_arguments<T, 3>& x, std::size_t i) const
+  {
+    return boost::math::hypergeometric_u(x(0, i), x(1, i), x(2, i), pol);
+  }
+};
+
+struct function_2f0
+{
+  template <class T>
+  T operator()(const strided_arguments<T, 3>& x, std::size_t i) const
+  {
+    return boost::math::hypergeometric_2f0(x(0, i), x(1, i), x(2, i), pol);
+  }
+};
+
+struct function_1f2
+{
+  template <class T>
+  T operator()(const strided_arguments<T, 4>& x, std::size_t i) const
+  {
+    return boost::math::hypergeometric_1f2(x(0, i), x(1, i), x(2, i), x(3, i), pol);
+  }
+};
+
+struct function_2f1
+{
+  template <class T>
+  T operator()(const strided_arguments<T, 4>& x, std::size_t i) const
+  {
+    return boost::math::hypergeometric_2f1(x(0, i), x(1, i), x(2, i), x(3, i), pol);
+  }
+};
+
+} // namespace
+
+// only function boilerplates are here
+
+#define BOOST_MATH_HYPERGEOMETRIC_BATCH_2(name, T, p0, p1)                                                        \
+  size_t name(const T* p0, ptrdiff_t p0##_stride, const T* p1, ptrdiff_t p1##_stride,                            \
+              T* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads)                       \
+  {                                                                                                               \
+    const strided_arguments<T, 2> args = { { p0, p1 }, { p0##_stride, p1##_stride } };                           \
+    return batch<T, 2, function_##name##_>(args, result, result_stride, n, errors, threads);                     \
+  }
+
+#define BOOST_MATH_HYPERGEOMETRIC_BATCH_3(name, T, p0, p1, p2)                                                    \
+  size_t name(const T* p0, ptrdiff_t p0##_stride, const T* p1, ptrdiff_t p1##_stride,                            \
+              const T* p2, ptrdiff_t p2##_stride,                                                                 \
+              T* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads)                       \
+  {                                                                                                               \
+    const strided_arguments<T, 3> args = { { p0, p1, p2 }, { p0##_stride, p1##_stride, p2##_stride } };          \
+    return batch<T, 3, function_##name##_>(args, result, result_stride, n, errors, threads);                     \
+  }
+
+#define BOOST_MATH_HYPERGEOMETRIC_BATCH_4(name, T, p0, p1, p2, p3)                                                \
+  size_t name(const T* p0, ptrdiff_t p0##_stride, const T* p1, ptrdiff_t p1##_stride,                            \
+              const T* p2, ptrdiff_t p2##_stride, const T* p3, ptrdiff_t p3##_stride,                            \
+              T* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads)                       \
+  {                                                                                                               \
+    const strided_arguments<T, 4> args = { { p0, p1, p2, p3 }, { p0##_stride, p1##_stride, p2##_stride, p3##_stride } }; \
+    return batch<T, 4, function_##name##_>(args, result, result_stride, n, errors, threads);                     \
+  }
+
+namespace
+{
+typedef function_0f1 function_hypergeometric_0f1_batch_f_, function_hypergeometric_0f1_batch_d_, function_hypergeometric_0f1_batch_l_;
+typedef function_1f0 function_hypergeometric_1f0_batch_f_, function_hypergeometric_1f0_batch_d_, function_hypergeometric_1f0_batch_l_;
+typedef function_1f1 function_hypergeometric_1f1_batch_f_, function_hypergeometric_1f1_batch_d_, function_hypergeometric_1f1_batch_l_;
+typedef function_u function_hypergeometric_u_batch_f_, function_hypergeometric_u_batch_d_, function_hypergeometric_u_batch_l_;
+typedef function_2f0 function_hypergeometric_2f0_batch_f_, function_hypergeometric_2f0_batch_d_, function_hypergeometric_2f0_batch_l_;
+typedef function_1f2 function_hypergeometric_1f2_batch_f_, function_hypergeometric_1f2_batch_d_, function_hypergeometric_1f2_batch_l_;
+typedef function_2f1 function_hypergeometric_2f1_batch_f_, function_hypergeometric_2f1_batch_d_, function_hypergeometric_2f1_batch_l_;
+}
+
+extern "C" {
+
+BOOST_MATH_HYPERGEOMETRIC_BATCH_2(hypergeometric_0f1_batch_f, float, b, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_2(hypergeometric_0f1_batch_d, double, b, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_2(hypergeometric_0f1_batch_l, long double, b, z)
+
+BOOST_MATH_HYPERGEOMETRIC_BATCH_2(hypergeometric_1f0_batch_f, float, a, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_2(hypergeometric_1f0_batch_d, double, a, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_2(hypergeometric_1f0_batch_l, long double, a, z)
+
+BOOST_MATH_HYPERGEOMETRIC_BATCH_3(hypergeometric_1f1_batch_f, float, a, b, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_3(hypergeometric_1f1_batch_d, double, a, b, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_3(hypergeometric_1f1_batch_l, long double, a, b, z)
+
+BOOST_MATH_HYPERGEOMETRIC_BATCH_3(hypergeometric_u_batch_f, float, a, b, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_3(hypergeometric_u_batch_d, double, a, b, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_3(hypergeometric_u_batch_l, long double, a, b, z)
+
+BOOST_MATH_HYPERGEOMETRIC_BATCH_3(hypergeometric_2f0_batch_f, float, a1, a2, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_3(hypergeometric_2f0_batch_d, double, a1, a2, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_3(hypergeometric_2f0_batch_l, long double, a1, a2, z)
+
+BOOST_MATH_HYPERGEOMETRIC_BATCH_4(hypergeometric_1f2_batch_f, float, a, b1, b2, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_4(hypergeometric_1f2_batch_d, double, a, b1, b2, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_4(hypergeometric_1f2_batch_l, long double, a, b1, b2, z)
+
+BOOST_MATH_HYPERGEOMETRIC_BATCH_4(hypergeometric_2f1_batch_f, float, a1, a2, b, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_4(hypergeometric_2f1_batch_d, double, a1, a2, b, z)
+BOOST_MATH_HYPERGEOMETRIC_BATCH_4(hypergeometric_2f1_batch_l, long double, a1, a2, b, z)
+
+} // extern "C"
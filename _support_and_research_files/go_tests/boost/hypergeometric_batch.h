@@ -0,0 +1,113 @@
+#ifndef BOOST_MATH_HYPERGEOMETRIC_BATCH_H
+  #define BOOST_MATH_HYPERGEOMETRIC_BATCH_H
+
+  #include <stddef.h>
+
+  /*
+   * Batch entry points of libboost_hypergeometric for foreign callers:
+   * one call evaluates n points, so the cost of crossing the language
+   * boundary is paid once per buffer rather than once per value.
+   *
+   * Every argument is a pointer with a stride, counted in elements: the
+   * i-th point takes x[i * x_stride], so a stride of 1 walks a packed
+   * array, a stride of 0 repeats a single value for every point, and a
+   * larger stride picks one field out of an array of records. Results
+   * are stored the same way. The buffers are read and written in place.
+   *
+   * errors, unless NULL, receives a hypergeometric_error code per point;
+   * the result of a point that failed is NaN. The return value is the
+   * number of points that failed.
+   *
+   * The points are split between threads; threads == 0 means one per
+   * hardware thread, and short batches stay on the calling thread.
+   */
+
+#ifdef __cplusplus
+  extern "C" {
+#endif
+
+  enum hypergeometric_error
+  {
+    hypergeometric_ok = 0,
+    hypergeometric_domain_error = 1,     /* also poles */
+    hypergeometric_overflow_error = 2,
+    hypergeometric_evaluation_error = 3, /* no method converged */
+    hypergeometric_other_error = 4
+  };
+
+  /* 0F1(; b; z) */
+  size_t hypergeometric_0f1_batch_f(const float* b, ptrdiff_t b_stride, const float* z, ptrdiff_t z_stride,
+                                    float* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_0f1_batch_d(const double* b, ptrdiff_t b_stride, const double* z, ptrdiff_t z_stride,
+                                    double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_0f1_batch_l(const long double* b, ptrdiff_t b_stride, const long double* z, ptrdiff_t z_stride,
+                                    long double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+
+  /* 1F0(a; ; z) */
+  size_t hypergeometric_1f0_batch_f(const float* a, ptrdiff_t a_stride, const float* z, ptrdiff_t z_stride,
+                                    float* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_1f0_batch_d(const double* a, ptrdiff_t a_stride, const double* z, ptrdiff_t z_stride,
+                                    double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_1f0_batch_l(const long double* a, ptrdiff_t a_stride, const long double* z, ptrdiff_t z_stride,
+                                    long double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+
+  /* 1F1(a; b; z) */
+  size_t hypergeometric_1f1_batch_f(const float* a, ptrdiff_t a_stride, const float* b, ptrdiff_t b_stride,
+                                    const float* z, ptrdiff_t z_stride,
+                                    float* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_1f1_batch_d(const double* a, ptrdiff_t a_stride, const double* b, ptrdiff_t b_stride,
+                                    const double* z, ptrdiff_t z_stride,
+                                    double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_1f1_batch_l(const long double* a, ptrdiff_t a_stride, const long double* b, ptrdiff_t b_stride,
+                                    const long double* z, ptrdiff_t z_stride,
+                                    long double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+
+  /* U(a, b, z), z > 0 */
+  size_t hypergeometric_u_batch_f(const float* a, ptrdiff_t a_stride, const float* b, ptrdiff_t b_stride,
+                                  const float* z, ptrdiff_t z_stride,
+                                  float* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_u_batch_d(const double* a, ptrdiff_t a_stride, const double* b, ptrdiff_t b_stride,
+                                  const double* z, ptrdiff_t z_stride,
+                                  double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_u_batch_l(const long double* a, ptrdiff_t a_stride, const long double* b, ptrdiff_t b_stride,
+                                  const long double* z, ptrdiff_t z_stride,
+                                  long double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+
+  /* 2F0(a1, a2; ; z) */
+  size_t hypergeometric_2f0_batch_f(const float* a1, ptrdiff_t a1_stride, const float* a2, ptrdiff_t a2_stride,
+                                    const float* z, ptrdiff_t z_stride,
+                                    float* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_2f0_batch_d(const double* a1, ptrdiff_t a1_stride, const double* a2, ptrdiff_t a2_stride,
+                                    const double* z, ptrdiff_t z_stride,
+                                    double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_2f0_batch_l(const long double* a1, ptrdiff_t a1_stride, const long double* a2, ptrdiff_t a2_stride,
+                                    const long double* z, ptrdiff_t z_stride,
+                                    long double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+
+  /* 1F2(a; b1, b2; z) */
+  size_t hypergeometric_1f2_batch_f(const float* a, ptrdiff_t a_stride, const float* b1, ptrdiff_t b1_stride,
+                                    const float* b2, ptrdiff_t b2_stride, const float* z, ptrdiff_t z_stride,
+                                    float* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_1f2_batch_d(const double* a, ptrdiff_t a_stride, const double* b1, ptrdiff_t b1_stride,
+                                    const double* b2, ptrdiff_t b2_stride, const double* z, ptrdiff_t z_stride,
+                                    double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_1f2_batch_l(const long double* a, ptrdiff_t a_stride, const long double* b1, ptrdiff_t b1_stride,
+                                    const long double* b2, ptrdiff_t b2_stride, const long double* z, ptrdiff_t z_stride,
+                                    long double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+
+  /* 2F1(a1, a2; b; z) */
+  size_t hypergeometric_2f1_batch_f(const float* a1, ptrdiff_t a1_stride, const float* a2, ptrdiff_t a2_stride,
+                                    const float* b, ptrdiff_t b_stride, const float* z, ptrdiff_t z_stride,
+                                    float* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_2f1_batch_d(const double* a1, ptrdiff_t a1_stride, const double* a2, ptrdiff_t a2_stride,
+                                    const double* b, ptrdiff_t b_stride, const double* z, ptrdiff_t z_stride,
+                                    double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+  size_t hypergeometric_2f1_batch_l(const long double* a1, ptrdiff_t a1_stride, const long double* a2, ptrdiff_t a2_stride,
+                                    const long double* b, ptrdiff_t b_stride, const long double* z, ptrdiff_t z_stride,
+                                    long double* result, ptrdiff_t result_stride, size_t n, int* errors, unsigned threads);
+
+#ifdef __cplusplus
+  } // extern "C"
+#endif
+
+#endif /* BOOST_MATH_HYPERGEOMETRIC_BATCH_H */
@@ -0,0 +1,128 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2014 Anton Bikineev
+//  Copyright 2014 Christopher Kormanyos
+//  Copyright 2014 John Maddock
+//  Copyright 2014 Paul Bristow
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the Abramowitz & Stegun 13.3.8 Bessel expansion of 1F1 against
+// the paths hypergeometric_1f1_imp takes without it (the plain series, and
+// for a < -10 the recurrences and 13.3.7) for a < 0 < z. The reference is
+// the plain series in cpp_dec_float_50, which keeps about 30 digits over
+// the grid below. Prints, per cell of the grid, the worst error in epsilons
+// and the mean time per call in microseconds of either method.
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <boost/math/special_functions/hypergeometric.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+
+namespace
+{
+  typedef double float_type;
+  typedef boost::multiprecision::cpp_dec_float_50 reference_type;
+
+  typedef boost::math::policies::policy<> policy_type;
+
+  struct statistics
+  {
+    statistics() : max_error(0), time(0), count(0) { }
+
+    void add(const float_type& value, const reference_type& reference, const double microseconds)
+    {
+      using std::fabs;
+
+      const float_type error =
+        static_cast<float_type>(fabs((reference_type(value) - reference) / reference)) /
+        boost::math::tools::epsilon<float_type>();
+
+      max_error = (std::max)(max_error, error);
+      time += microseconds;
+      ++count;
+    }
+
+    float_type max_error;
+    double time;
+    unsigned count;
+  };
+
+  template <class Function>
+  float_type timed(Function f, const float_type& a, const float_type& b, const float_type& z, double& microseconds)
+  {
+    static const unsigned repetitions = 100u;
+
+    float_type result = 0;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (unsigned i = 0u; i < repetitions; ++i)
+      result = f(a, b, z, policy_type());
+    const std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+    microseconds = std::chrono::duration<double, std::micro>(stop - start).count() / repetitions;
+    return result;
+  }
+
+  float_type existing_path(const float_type& a, const float_type& b, const float_type& z, const policy_type& pol)
+  {
+    if (boost::math::detail::hypergeometric_1f1_is_a_small_enough(a))
+    {
+      if ((2 * (z * (b - (2 * a)))) > 0)
+        return boost::math::detail::hypergeometric_1f1_13_3_7_series(a, b, z, pol);
+      else if (b < a)
+        return boost::math::detail::hypergeometric_1f1_backward_recurrence_for_negative_b(a, b, z, pol);
+    }
+
+    return boost::math::detail::hypergeometric_1f1_generic_series(a, b, z, pol);
+  }
+
+  float_type bessel_13_3_8(const float_type& a, const float_type& b, const float_type& z, const policy_type& pol)
+  {
+    return boost::math::detail::hypergeometric_1f1_13_3_8_series(a, b, z, pol);
+  }
+}
+
+int main()
+{
+  const float_type as[] = { -0.75, -2.25, -5.5, -9.125, -17.25, -33.5 };
+  const float_type bs[] = { -3.5, 0.5, 1.75, 6.25, 15.5, 30.25 };
+  const float_type zs[] = { 0.5, 2, 8, 20, 45 };
+
+  std::cout << std::setw(9) << "a" << std::setw(9) << "z"
+            << std::setw(14) << "err 13.3.8" << std::setw(14) << "err current"
+            << std::setw(12) << "us 13.3.8" << std::setw(12) << "us current"
+            << std::endl;
+
+  for (const float_type* a = as; a != as + sizeof(as) / sizeof(as[0]); ++a)
+  {
+    for (const float_type* z = zs; z != zs + sizeof(zs) / sizeof(zs[0]); ++z)
+    {
+      statistics bessel, current;
+
+      for (const float_type* b = bs; b != bs + sizeof(bs) / sizeof(bs[0]); ++b)
+      {
+        const reference_type reference =
+          boost::math::detail::hypergeometric_1f1_generic_series(reference_type(*a), reference_type(*b), reference_type(*z), policy_type());
+
+        double microseconds = 0;
+        const float_type by_bessel = timed(bessel_13_3_8, *a, *b, *z, microseconds);
+        bessel.add(by_bessel, reference, microseconds);
+
+        const float_type by_current = timed(existing_path, *a, *b, *z, microseconds);
+        current.add(by_current, reference, microseconds);
+      }
+
+      std::cout << std::setw(9) << *a << std::setw(9) << *z
+                << std::setw(14) << std::setprecision(3) << bessel.max_error
+                << std::setw(14) << current.max_error
+                << std::setw(12) << bessel.time / bessel.count
+                << std::setw(12) << current.time / current.count
+                << std::endl;
+    }
+  }
+}
@@ -0,0 +1,363 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2014 Anton Bikineev
+//  Copyright 2014 Christopher Kormanyos
+//  Copyright 2014 John Maddock
+//  Copyright 2014 Paul Bristow
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Accuracy against speed of the 1F1 kernels. Every kernel that applies to
+// a point of the data is run on it, timed, and its error against the
+// reference value measured in epsilons of float_type. The points are split
+// into regions by the signs of a and z and the magnitude of z, and for
+// every region the report lists, per kernel, the share of points it applies
+// to, the median, 90% and 99% quantile and maximum error, and the mean time
+// per call. A kernel that fails on a point (throws, or an asymptotic series
+// that is not accurate) counts as an infinite error there.
+//
+// Of the kernels that apply to the whole region, those not beaten in both
+// the 99% quantile of the error and the time by another one form the Pareto
+// front, marked with *; below the table is the fastest kernel at each
+// level of accuracy. The same numbers go to a CSV file.
+//
+//   hypergeometric_1f1_pareto_report [-csv file] [-repeat n] [data.bin ...]
+//
+// The data files are in the format of boost/math/tools/binary_test_data.hpp
+// with the columns a, b, z, 1F1(a, b, z); without any, the tables of
+// test_hypergeometric_1f1 are used.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/math/special_functions/hypergeometric.hpp>
+#include <boost/math/special_functions/detail/hypergeometric_cf.hpp>
+#include <boost/math/tools/binary_test_data.hpp>
+
+namespace
+{
+  typedef double float_type;
+  typedef long double reference_type;
+
+  typedef boost::math::policies::policy<boost::math::policies::promote_double<false> > policy_type;
+
+  typedef boost::array<reference_type, 4> row_type;
+
+  struct kernel
+  {
+    const char* name;
+    bool (*applies)(const float_type& a, const float_type& b, const float_type& z);
+    bool (*evaluate)(const float_type& a, const float_type& b, const float_type& z, float_type& result);
+  };
+
+  bool always(const float_type&, const float_type&, const float_type&) { return true; }
+  bool a_is_one(const float_type& a, const float_type&, const float_type&) { return a == 1; }
+  bool a_is_negative(const float_type& a, const float_type&, const float_type&) { return a < 0; }
+  bool a_is_positive(const float_type& a, const float_type&, const float_type&) { return a > 0; }
+  bool b_is_negative(const float_type&, const float_type& b, const float_type&) { return b < 0; }
+
+  // the asymptotic series assert that they are clear of the poles of their gamma functions
+  bool non_positive_integer(const float_type& x) { return (x <= 0) && (x == std::floor(x)); }
+  bool asym_positive_applies(const float_type& a, const float_type& b, const float_type& z)
+  {
+    return (z > 0) && !non_positive_integer(a) && !non_positive_integer(b);
+  }
+  bool asym_negative_applies(const float_type& a, const float_type& b, const float_type& z)
+  {
+    return (z < 0) && !non_positive_integer(a) && !non_positive_integer(b - a);
+  }
+  bool a_negative_z_positive(const float_type& a, const float_type&, const float_type& z) { return (a < 0) && (z > 0); }
+  bool z_and_b_minus_2a_positive(const float_type& a, const float_type& b, const float_type& z) { return (z > 0) && (b > 2 * a); }
+
+  #define BOOST_MATH_PARETO_KERNEL(name, call)                                                      \
+    bool name(const float_type& a, const float_type& b, const float_type& z, float_type& result)  \
+    {                                                                                              \
+      result = call;                                                                               \
+      return true;                                                                                 \
+    }
+
+  BOOST_MATH_PARETO_KERNEL(dispatcher, boost::math::detail::hypergeometric_1f1_imp(a, b, z, policy_type()))
+  BOOST_MATH_PARETO_KERNEL(generic_series, boost::math::detail::hypergeometric_1f1_generic_series(a, b, z, policy_type()))
+  BOOST_MATH_PARETO_KERNEL(separated_series, boost::math::detail::hypergeometric_1f1_separated_series(a, b, z, policy_type()))
+  BOOST_MATH_PARETO_KERNEL(continued_fraction, boost::math::detail::hypergeometric_1f1_cf(a, b, z, policy_type()))
+  BOOST_MATH_PARETO_KERNEL(rational, boost::math::detail::hypergeometric_1f1_rational(a, b, z, policy_type()))
+  BOOST_MATH_PARETO_KERNEL(bessel_13_3_7, boost::math::detail::hypergeometric_1f1_13_3_7_series(a, b, z, policy_type()))
+  BOOST_MATH_PARETO_KERNEL(bessel_13_3_8, boost::math::detail::hypergeometric_1f1_13_3_8_series(a, b, z, policy_type()))
+  BOOST_MATH_PARETO_KERNEL(backward_a, boost::math::detail::hypergeometric_1f1_backward_recurrence_for_negative_a(a, b, z, policy_type()))
+  BOOST_MATH_PARETO_KERNEL(forward_a, boost::math::detail::hypergeometric_1f1_forward_recurrence_for_positive_a(a, b, z, policy_type()))
+  BOOST_MATH_PARETO_KERNEL(backward_b, boost::math::detail::hypergeometric_1f1_backward_recurrence_for_negative_b(a, b, z, policy_type()))
+
+  // Pade's approximation is of 1F1(1; b; z), a is not needed
+  bool pade(const float_type&, const float_type& b, const float_type& z, float_type& result)
+  {
+    result = boost::math::detail::hypergeometric_1f1_pade(b, z, policy_type());
+    return true;
+  }
+
+  #undef BOOST_MATH_PARETO_KERNEL
+
+  bool asym_positive(const float_type& a, const float_type& b, const float_type& z, float_type& result)
+  {
+    return boost::math::detail::hypergeometric_1f1_asym_positive_series(a, b, z, result, policy_type());
+  }
+
+  bool asym_negative(const float_type& a, const float_type& b, const float_type& z, float_type& result)
+  {
+    return boost::math::detail::hypergeometric_1f1_asym_negative_series(a, b, z, result, policy_type());
+  }
+
+  const kernel kernels[] =
+  {
+    { "dispatcher",         &always,                    &dispatcher },
+    { "generic series",     &always,                    &generic_series },
+    { "separated series",   &always,                    &separated_series },
+    { "continued fraction", &always,                    &continued_fraction },
+    { "Luke rational",      &always,                    &rational },
+    { "Luke Pade",          &a_is_one,                  &pade },
+    { "A&S 13.3.7",         &z_and_b_minus_2a_positive, &bessel_13_3_7 },
+    { "A&S 13.3.8",         &a_negative_z_positive,     &bessel_13_3_8 },
+    { "asymptotic z > 0",   &asym_positive_applies,     &asym_positive },
+    { "asymptotic z < 0",   &asym_negative_applies,     &asym_negative },
+    { "backward in a",      &a_is_negative,             &backward_a },
+    { "forward in a",       &a_is_positive,             &forward_a },
+    { "backward in b",      &b_is_negative,             &backward_b }
+  };
+
+  const unsigned kernel_count = sizeof(kernels) / sizeof(kernels[0]);
+
+  std::string region_of(const row_type& row)
+  {
+    using std::fabs;
+
+    const reference_type z = fabs(row[2]);
+    const char* const band = (z < 1) ? "|z| < 1" : ((z < 10) ? "1 <= |z| < 10" : ((z < 100) ? "10 <= |z| < 100" : "|z| >= 100"));
+
+    return std::string(row[0] < 0 ? "a < 0, " : "a >= 0, ") + (row[2] < 0 ? "z < 0, " : "z >= 0, ") + band;
+  }
+
+  // error in epsilons, infinite on failure
+  float_type run(const kernel& k, const row_type& row, const unsigned repeat, double& nanoseconds)
+  {
+    using std::fabs;
+
+    const float_type a = static_cast<float_type>(row[0]);
+    const float_type b = static_cast<float_type>(row[1]);
+    const float_type z = static_cast<float_type>(row[2]);
+
+    float_type result = 0;
+    bool accurate = true;
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    try
+    {
+      for (unsigned i = 0u; i < repeat; ++i)
+        accurate = k.evaluate(a, b, z, result);
+    }
+    catch (const std::exception&)
+    {
+      accurate = false;
+    }
+    const std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+    nanoseconds = std::chrono::duration<double, std::nano>(stop - start).count() / repeat;
+
+    if (!accurate || !(fabs(result) <= (std::numeric_limits<float_type>::max)()))
+      return std::numeric_limits<float_type>::infinity();
+
+    const reference_type error = (row[3] == 0) ? fabs(static_cast<reference_type>(result)) :
+      fabs((static_cast<reference_type>(result) - row[3]) / row[3]);
+
+    return static_cast<float_type>(error / std::numeric_limits<float_type>::epsilon());
+  }
+
+  struct statistics
+  {
+    statistics() : points(0u), time(0) { }
+
+    float_type quantile(const double q) const
+    {
+      if (errors.empty())
+        return 0;
+
+      const std::size_t i = std::min(errors.size() - 1, static_cast<std::size_t>(q * errors.size()));
+      return errors[i];
+    }
+
+    std::size_t points;
+    std::vector<float_type> errors;
+    double time;
+  };
+
+  struct region
+  {
+    region() : points(0u), kernels(kernel_count) { }
+
+    std::size_t points;
+    std::vector<statistics> kernels;
+  };
+
+  void add_rows(std::vector<row_type>& rows, const char* path)
+  {
+    const boost::math::tools::binary_test_data<reference_type, 4> data(path);
+    for (std::size_t i = 0; i < data.size(); ++i)
+      rows.push_back(data[i]);
+  }
+
+  template <class Table>
+  void add_table(std::vector<row_type>& rows, const Table& table)
+  {
+    for (std::size_t i = 0; i < table.size(); ++i)
+    {
+      row_type row;
+      std::copy(table[i].begin(), table[i].end(), row.begin());
+      rows.push_back(row);
+    }
+  }
+
+  void add_test_tables(std::vector<row_type>& rows)
+  {
+    typedef reference_type T;
+
+    #include "../test/hypergeometric_1f1_luke_rational_data.ipp"
+    add_table(rows, hypergeometric_1f1_luke_rational_data);
+    #include "../test/hypergeometric_1f1_luke_pade_moderate_data.ipp"
+    add_table(rows, hypergeometric_1f1_luke_pade_moderate_data);
+    #include "../test/hypergeometric_1f1_moderate_data.ipp"
+    add_table(rows, hypergeometric_1f1_moderate_data);
+  }
+
+  bool dominated(const statistics& s, const statistics& other)
+  {
+    const float_type e = s.quantile(0.99), oe = other.quantile(0.99);
+    const double t = s.time / s.points, ot = other.time / other.points;
+
+    return (oe <= e) && (ot <= t) && ((oe < e) || (ot < t));
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  std::string csv_path("hypergeometric_1f1_pareto_report.csv");
+  unsigned repeat = 10u;
+  std::vector<row_type> rows;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg(argv[i]);
+    if ((arg == "-csv") && (i + 1 < argc))
+      csv_path = argv[++i];
+    else if ((arg == "-repeat") && (i + 1 < argc))
+      repeat = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+    else
+      add_rows(rows, argv[i]);
+  }
+
+  if (rows.empty())
+    add_test_tables(rows);
+
+  std::vector<std::string> names;
+  std::vector<region> regions;
+
+  for (std::size_t i = 0; i < rows.size(); ++i)
+  {
+    const std::string name = region_of(rows[i]);
+    const std::size_t r = std::find(names.begin(), names.end(), name) - names.begin();
+    if (r == names.size())
+    {
+      names.push_back(name);
+      regions.push_back(region());
+    }
+
+    ++regions[r].points;
+
+    const float_type a = static_cast<float_type>(rows[i][0]);
+    const float_type b = static_cast<float_type>(rows[i][1]);
+    const float_type z = static_cast<float_type>(rows[i][2]);
+
+    for (unsigned k = 0u; k < kernel_count; ++k)
+    {
+      if (!kernels[k].applies(a, b, z))
+        continue;
+
+      double nanoseconds = 0;
+      statistics& s = regions[r].kernels[k];
+      s.errors.push_back(run(kernels[k], rows[i], repeat, nanoseconds));
+      s.time += nanoseconds;
+      ++s.points;
+    }
+  }
+
+  static const float_type levels[] = { 1, 4, 16, 64, 256, 1024, 65536, 1048576 };
+
+  std::ofstream csv(csv_path.c_str());
+  csv << "region,kernel,points,coverage,median,p90,p99,max,ns,pareto\n";
+
+  for (std::size_t r = 0; r < regions.size(); ++r)
+  {
+    region& reg = regions[r];
+
+    std::vector<bool> complete(kernel_count), front(kernel_count);
+    for (unsigned k = 0u; k < kernel_count; ++k)
+    {
+      std::sort(reg.kernels[k].errors.begin(), reg.kernels[k].errors.end());
+      complete[k] = (reg.kernels[k].points == reg.points);
+    }
+
+    for (unsigned k = 0u; k < kernel_count; ++k)
+    {
+      front[k] = complete[k];
+      for (unsigned j = 0u; front[k] && (j < kernel_count); ++j)
+        front[k] = !(complete[j] && dominated(reg.kernels[k], reg.kernels[j]));
+    }
+
+    std::cout << names[r] << ", " << reg.points << " points\n"
+              << std::setw(22) << "kernel" << std::setw(10) << "coverage"
+              << std::setw(11) << "median" << std::setw(11) << "90%" << std::setw(11) << "99%" << std::setw(11) << "max"
+              << std::setw(11) << "ns/call" << "\n";
+
+    for (unsigned k = 0u; k < kernel_count; ++k)
+    {
+      const statistics& s = reg.kernels[k];
+      if (!s.points)
+        continue;
+
+      const double coverage = static_cast<double>(s.points) / reg.points;
+      const double ns = s.time / s.points;
+
+      std::cout << std::setw(21) << kernels[k].name << (front[k] ? "*" : " ")
+                << std::setw(9) << std::setprecision(3) << 100 * coverage << "%"
+                << std::setw(11) << s.quantile(0.5) << std::setw(11) << s.quantile(0.9) << std::setw(11) << s.quantile(0.99)
+                << std::setw(11) << s.errors.back() << std::setw(11) << ns << "\n";
+
+      csv << '"' << names[r] << "\",\"" << kernels[k].name << "\"," << s.points << ',' << coverage << ','
+          << s.quantile(0.5) << ',' << s.quantile(0.9) << ',' << s.quantile(0.99) << ',' << s.errors.back() << ','
+          << ns << ',' << (front[k] ? 1 : 0) << '\n';
+    }
+
+    std::cout << "  fastest with 99% of errors within";
+    for (unsigned l = 0u; l < sizeof(levels) / sizeof(levels[0]); ++l)
+    {
+      int best = -1;
+      for (unsigned k = 0u; k < kernel_count; ++k)
+      {
+        const statistics& s = reg.kernels[k];
+        if (complete[k] && (s.quantile(0.99) <= levels[l]) &&
+            ((best < 0) || (s.time < reg.kernels[best].time)))
+          best = static_cast<int>(k);
+      }
+
+      std::cout << "\n    " << std::setw(8) << levels[l] << " eps: " << ((best < 0) ? "none" : kernels[best].name);
+    }
+    std::cout << "\n" << std::endl;
+  }
+}
@@ -0,0 +1,332 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2014 Anton Bikineev
+//  Copyright 2014 Christopher Kormanyos
+//  Copyright 2014 John Maddock
+//  Copyright 2014 Paul Bristow
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Head to head of hypergeometric_1f1 and CHGM of Zhang and Jin's specfun,
+// the routine behind scipy's hyp1f1, on the sources bundled with
+// go_tests/cephes_scipy. Both sides are called in double: boost as users
+// get it (promoted to long double internally) and with promote_double<false>.
+//
+// For every set of points the report gives the time per call of each side,
+// how many times slower boost is, and the median, 99% quantile and maximum
+// error in epsilons of double. Points a side returns as non finite (or
+// 1e300, specfun's overflow mark) count as failures, not errors. The sets
+// are the three test tables and data files given on the command line, all
+// checked against their reference values, and random regions, which have
+// no reference: there the errors are measured against boost in long double,
+// so they show where the two disagree rather than who is right, and the
+// point of largest disagreement is printed.
+//
+//   gfortran -O2 -c go_tests/cephes_scipy/specfun.f
+//   g++ -O2 -I.. hypergeometric_1f1_specfun_benchmark.cpp specfun.o -lgfortran
+//   hypergeometric_1f1_specfun_benchmark [-repeat n] [-points n] [data.bin ...]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/math/special_functions/hypergeometric.hpp>
+#include <boost/math/tools/binary_test_data.hpp>
+
+// specfun.f, compiled by gfortran
+extern "C" void chgm_(double* a, double* b, double* x, double* hg);
+
+namespace
+{
+  typedef long double reference_type;
+  typedef boost::array<reference_type, 4> row_type;
+
+  using namespace boost::math::policies;
+
+  // failures become non finite values instead of exceptions, as in specfun
+  typedef policy<
+    domain_error<ignore_error>,
+    pole_error<ignore_error>,
+    overflow_error<ignore_error>,
+    evaluation_error<ignore_error>
+      > promoted_policy;
+
+  typedef policy<
+    domain_error<ignore_error>,
+    pole_error<ignore_error>,
+    overflow_error<ignore_error>,
+    evaluation_error<ignore_error>,
+    promote_double<false>
+      > double_policy;
+
+  double specfun(double a, double b, double z)
+  {
+    // CHGM works on its arguments in place
+    double result = 0;
+    chgm_(&a, &b, &z, &result);
+    return result;
+  }
+
+  double boost_promoted(double a, double b, double z)
+  {
+    return boost::math::hypergeometric_1f1(a, b, z, promoted_policy());
+  }
+
+  double boost_double(double a, double b, double z)
+  {
+    return boost::math::hypergeometric_1f1(a, b, z, double_policy());
+  }
+
+  struct contender
+  {
+    const char* name;
+    double (*evaluate)(double a, double b, double z);
+  };
+
+  const contender contenders[] =
+  {
+    { "specfun CHGM", &specfun },
+    { "boost", &boost_promoted },
+    { "boost double", &boost_double }
+  };
+
+  const unsigned contender_count = sizeof(contenders) / sizeof(contenders[0]);
+
+  struct data_set
+  {
+    std::string name;
+    bool reference;
+    std::vector<row_type> rows;
+  };
+
+  struct statistics
+  {
+    statistics() : failures(0u), nanoseconds(0), worst(0u) { }
+
+    double quantile(const double q) const
+    {
+      if (errors.empty())
+        return 0;
+
+      const std::size_t i = std::min(errors.size() - 1, static_cast<std::size_t>(q * errors.size()));
+      return errors[i];
+    }
+
+    std::size_t failures;
+    std::vector<double> errors;
+    double nanoseconds;
+    std::size_t worst;
+  };
+
+  bool failed(const double value)
+  {
+    using std::fabs;
+    return !(fabs(value) < 1e300);
+  }
+
+  statistics measure(const contender& c, const std::vector<row_type>& rows, const unsigned repeat)
+  {
+    using std::fabs;
+
+    std::vector<double> a(rows.size()), b(rows.size()), z(rows.size()), results(rows.size());
+    for (std::size_t i = 0; i < rows.size(); ++i)
+    {
+      a[i] = static_cast<double>(rows[i][0]);
+      b[i] = static_cast<double>(rows[i][1]);
+      z[i] = static_cast<double>(rows[i][2]);
+    }
+
+    statistics s;
+
+    // the fastest of the repetitions, the machine is shared
+    s.nanoseconds = std::numeric_limits<double>::infinity();
+    for (unsigned r = 0u; r < repeat; ++r)
+    {
+      const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (std::size_t i = 0; i < rows.size(); ++i)
+        results[i] = c.evaluate(a[i], b[i], z[i]);
+      const std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+      s.nanoseconds = std::min(s.nanoseconds, std::chrono::duration<double, std::nano>(stop - start).count() / rows.size());
+    }
+
+    double worst = -1;
+    for (std::size_t i = 0; i < rows.size(); ++i)
+    {
+      // out of the range of double, nothing to compare with
+      if (failed(static_cast<double>(rows[i][3])))
+        continue;
+
+      if (failed(results[i]))
+      {
+        ++s.failures;
+        continue;
+      }
+
+      const reference_type error = (rows[i][3] == 0) ? fabs(static_cast<reference_type>(results[i])) :
+        fabs((static_cast<reference_type>(results[i]) - rows[i][3]) / rows[i][3]);
+      const double eps = static_cast<double>(error / std::numeric_limits<double>::epsilon());
+
+      s.errors.push_back(eps);
+      if (eps > worst)
+      {
+        worst = eps;
+        s.worst = i;
+      }
+    }
+
+    std::sort(s.errors.begin(), s.errors.end());
+    return s;
+  }
+
+  void add_table_set(std::vector<data_set>& sets, const std::string& name)
+  {
+    data_set set;
+    set.name = name;
+    set.reference = true;
+    sets.push_back(set);
+  }
+
+  template <class Table>
+  void fill(std::vector<row_type>& rows, const Table& table)
+  {
+    for (std::size_t i = 0; i < table.size(); ++i)
+    {
+      row_type row;
+      std::copy(table[i].begin(), table[i].end(), row.begin());
+      rows.push_back(row);
+    }
+  }
+
+  void add_test_tables(std::vector<data_set>& sets)
+  {
+    typedef reference_type T;
+
+    #include "../test/hypergeometric_1f1_luke_rational_data.ipp"
+    add_table_set(sets, "luke rational data");
+    fill(sets.back().rows, hypergeometric_1f1_luke_rational_data);
+    #include "../test/hypergeometric_1f1_luke_pade_moderate_data.ipp"
+    add_table_set(sets, "luke pade moderate data");
+    fill(sets.back().rows, hypergeometric_1f1_luke_pade_moderate_data);
+    #include "../test/hypergeometric_1f1_moderate_data.ipp"
+    add_table_set(sets, "moderate data");
+    fill(sets.back().rows, hypergeometric_1f1_moderate_data);
+  }
+
+  void add_file(std::vector<data_set>& sets, const char* path)
+  {
+    const boost::math::tools::binary_test_data<reference_type, 4> data(path);
+
+    add_table_set(sets, path);
+    for (std::size_t i = 0; i < data.size(); ++i)
+      sets.back().rows.push_back(data[i]);
+  }
+
+  struct random_region
+  {
+    const char* name;
+    double a_min, a_max, b_min, b_max, z_min, z_max;
+  };
+
+  const random_region random_regions[] =
+  {
+    { "random |z| < 1",          -10,  10,  0.5,  10,    -1,   1 },
+    { "random |z| < 10",         -10,  10,  0.5,  10,   -10,  10 },
+    { "random 10 < z < 100",     -10,  10,  0.5,  10,    10, 100 },
+    { "random -100 < z < -10",   -10,  10,  0.5,  10,  -100, -10 },
+    { "random |a|, b < 100",    -100, 100,  0.5, 100,   -10,  10 },
+    { "random b < 0",            -10,  10,  -10, -0.5,  -10,  10 }
+  };
+
+  void add_random_regions(std::vector<data_set>& sets, const std::size_t points)
+  {
+    std::mt19937 gen(2014u);
+
+    for (std::size_t r = 0; r < sizeof(random_regions) / sizeof(random_regions[0]); ++r)
+    {
+      const random_region& region = random_regions[r];
+      std::uniform_real_distribution<double> a(region.a_min, region.a_max), b(region.b_min, region.b_max), z(region.z_min, region.z_max);
+
+      data_set set;
+      set.name = region.name;
+      set.reference = false;
+
+      for (std::size_t i = 0; i < points; ++i)
+      {
+        row_type row;
+        row[0] = a(gen);
+        row[1] = b(gen);
+        row[2] = z(gen);
+        row[3] = boost::math::hypergeometric_1f1(row[0], row[1], row[2], promoted_policy());
+        set.rows.push_back(row);
+      }
+
+      sets.push_back(set);
+    }
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  unsigned repeat = 5u;
+  std::size_t points = 1000u;
+  std::vector<data_set> sets;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg(argv[i]);
+    if ((arg == "-repeat") && (i + 1 < argc))
+      repeat = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+    else if ((arg == "-points") && (i + 1 < argc))
+      points = static_cast<std::size_t>(std::max(1, std::atoi(argv[++i])));
+    else
+      add_file(sets, argv[i]);
+  }
+
+  if (sets.empty())
+    add_test_tables(sets);
+  add_random_regions(sets, points);
+
+  for (std::size_t n = 0; n < sets.size(); ++n)
+  {
+    const data_set& set = sets[n];
+
+    std::vector<statistics> results;
+    for (unsigned c = 0u; c < contender_count; ++c)
+      results.push_back(measure(contenders[c], set.rows, repeat));
+
+    std::cout << set.name << ", " << set.rows.size() << " points, errors in eps "
+              << (set.reference ? "against the reference" : "against boost in long double") << "\n"
+              << std::setw(16) << "" << std::setw(11) << "ns/call" << std::setw(11) << "x specfun"
+              << std::setw(11) << "median" << std::setw(11) << "99%" << std::setw(11) << "max"
+              << std::setw(10) << "failures" << "\n";
+
+    for (unsigned c = 0u; c < contender_count; ++c)
+    {
+      const statistics& s = results[c];
+
+      std::cout << std::setprecision(3)
+                << std::setw(16) << contenders[c].name << std::setw(11) << s.nanoseconds
+                << std::setw(11) << s.nanoseconds / results[0].nanoseconds
+                << std::setw(11) << s.quantile(0.5) << std::setw(11) << s.quantile(0.99)
+                << std::setw(11) << (s.errors.empty() ? 0 : s.errors.back()) << std::setw(10) << s.failures << "\n";
+    }
+
+    if (!set.reference && !results[0].errors.empty())
+    {
+      const row_type& row = set.rows[results[0].worst];
+      std::cout << std::setprecision(17) << "  largest disagreement at a = " << static_cast<double>(row[0])
+                << ", b = " << static_cast<double>(row[1]) << ", z = " << static_cast<double>(row[2]) << "\n";
+    }
+
+    std::cout << std::endl;
+  }
+}
@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2014 Anton Bikineev
+//  Copyright 2014 Christopher Kormanyos
+//  Copyright 2014 John Maddock
+//  Copyright 2014 Paul Bristow
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Heap allocations and time per call of the hypergeometric kernels that
+// have an in-place path (boost/math/tools/inplace_arithmetic.hpp) with
+// multiprecision types: gmp_float, whose every number is a heap block,
+// and cpp_dec_float, which does not allocate but copies its limbs for
+// every temporary. The allocations of gmp are counted through its memory
+// functions, those of everything else through operator new.
+//
+// Build it twice to compare the in-place path with the expressions:
+//
+//   g++ -O2 -I.. hypergeometric_inplace_arithmetic_benchmark.cpp -lgmp
+//   g++ -O2 -I.. -DBOOST_MATH_NO_INPLACE_ARITHMETIC hypergeometric_inplace_arithmetic_benchmark.cpp -lgmp
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <new>
+
+#include <gmp.h>
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+
+#include <boost/math/special_functions/hypergeometric.hpp>
+
+namespace
+{
+  unsigned long long allocations = 0u;
+  const unsigned rounds = 5u;
+
+  void* counted_allocate(std::size_t n)
+  {
+    ++allocations;
+    return std::malloc(n);
+  }
+
+  void* counted_reallocate(void* p, std::size_t, std::size_t n)
+  {
+    ++allocations;
+    return std::realloc(p, n);
+  }
+
+  void counted_free(void* p, std::size_t)
+  {
+    std::free(p);
+  }
+
+  typedef boost::math::policies::policy<> policy_type;
+
+  template <class T>
+  struct series_1f1
+  {
+    static const char* name() { return "1F1 series"; }
+    T operator()() const { return boost::math::detail::hypergeometric_1f1_generic_series(T(-7.25), T(3.5), T(11.5), policy_type()); }
+  };
+
+  template <class T>
+  struct series_0f1
+  {
+    static const char* name() { return "0F1 series"; }
+    T operator()() const { return boost::math::detail::hypergeometric_0f1_generic_series(T(2.5), T(-40), policy_type()); }
+  };
+
+  template <class T>
+  struct series_2f1
+  {
+    static const char* name() { return "2F1 series"; }
+    T operator()() const { return boost::math::detail::hypergeometric_2f1_generic_series(T(1.5), T(2.25), T(3.75), T(0.75), policy_type()); }
+  };
+
+  template <class T>
+  struct rational_1f1
+  {
+    static const char* name() { return "Luke rational"; }
+    T operator()() const { return boost::math::detail::hypergeometric_1f1_rational(T(126.98), T(350.5), T(7.5), policy_type()); }
+  };
+
+  template <class T>
+  struct pade_1f1
+  {
+    static const char* name() { return "Luke Pade"; }
+    T operator()() const { return boost::math::detail::hypergeometric_1f1_pade(T(-38.5), T(-80.25), policy_type()); }
+  };
+
+  template <class T>
+  struct recurrence_a
+  {
+    static const char* name() { return "recurrence on a"; }
+    T operator()() const
+    {
+      boost::math::detail::hypergeometric_1f1_recurrence_a_coefficients<T> coefficients(T(-0.25), T(3.5), T(2.5));
+      return boost::math::tools::solve_recurrence_relation_backward(coefficients, 100u, T(1.1875), T(1.25));
+    }
+  };
+
+  template <class Kernel>
+  void run(const unsigned repeat)
+  {
+    const Kernel kernel;
+    kernel(); // warm up the statics
+
+    const unsigned long long before = allocations;
+
+    // the fastest of the rounds, the machine is shared
+    double microseconds = std::numeric_limits<double>::infinity();
+    for (unsigned round = 0u; round < rounds; ++round)
+    {
+      const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (unsigned i = 0u; i < repeat; ++i)
+        kernel();
+      const std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+      microseconds = (std::min)(microseconds, std::chrono::duration<double, std::micro>(stop - start).count() / repeat);
+    }
+
+    std::cout << std::setw(20) << Kernel::name()
+              << std::setw(14) << static_cast<double>(allocations - before) / (rounds * repeat)
+              << std::setw(14) << microseconds << "\n";
+  }
+
+  template <class T>
+  void run_all(const char* type, const unsigned repeat)
+  {
+    std::cout << type << "\n" << std::setw(20) << "kernel" << std::setw(14) << "allocations" << std::setw(14) << "us/call" << "\n";
+
+    run<series_1f1<T> >(repeat);
+    run<series_0f1<T> >(repeat);
+    run<series_2f1<T> >(repeat);
+    run<rational_1f1<T> >(repeat);
+    run<pade_1f1<T> >(repeat);
+    run<recurrence_a<T> >(repeat);
+
+    std::cout << std::endl;
+  }
+}
+
+void* operator new(std::size_t n)
+{
+  ++allocations;
+  if (void* p = std::malloc(n))
+    return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+int main()
+{
+  mp_set_memory_functions(&counted_allocate, &counted_reallocate, &counted_free);
+
+#ifdef BOOST_MATH_NO_INPLACE_ARITHMETIC
+  std::cout << "expressions (BOOST_MATH_NO_INPLACE_ARITHMETIC)\n\n";
+#else
+  std::cout << "in-place arithmetic\n\n";
+#endif
+
+  run_all<boost::multiprecision::mpf_float_50>("mpf_float_50", 400u);
+  run_all<boost::multiprecision::cpp_dec_float_100>("cpp_dec_float_100", 100u);
+}
@@ -11,8 +11,32 @@
 #ifndef BOOST_MATH_HYPERGEOMETRIC_0F1_BESSEL_HPP
   #define BOOST_MATH_HYPERGEOMETRIC_0F1_BESSEL_HPP
 
+  #include <boost/math/tools/precision.hpp>
+  #include <boost/math/special_functions/bessel.hpp>
+  #include <boost/math/special_functions/factorials.hpp>
+  #include <boost/math/special_functions/gamma.hpp>
+  #include <boost/math/special_functions/sign.hpp>
+
   namespace boost { namespace math { namespace detail {
 
+  // For negative z the terms of the series grow up to about e^(2 sqrt(-z))
+  // once -z exceeds |b|, and the sum cancels down to O(1); the crossover
+  // beyond which this loss outweighs the cost of the Bessel function
+  // grows with the precision of T. For positive z every term is positive
+  // and the series is only left for its cost of about sqrt(z) terms.
+  template <class T>
+  inline bool hypergeometric_0f1_bessel_region(const T& b, const T& z)
+  {
+    BOOST_MATH_STD_USING // fabs, sqrt
+
+    const T sqrt_z = sqrt(fabs(z));
+
+    if (z < 0)
+      return (-z > fabs(b)) && ((2 * sqrt_z) > (tools::digits<T>() / 16));
+
+    return sqrt_z > 512;
+  }
+
   template <class T, class Policy>
   inline T hypergeometric_0f1_bessel(const T& b, const T& z, const Policy& pol)
   {
@@ -21,12 +45,30 @@
     const bool is_z_nonpositive = z <= 0;
 
     const T sqrt_z = is_z_nonpositive ? T(sqrt(-z)) : T(sqrt(z));
-    const T sqrt_z_pow_b = pow(sqrt_z, b);
     const T bessel_mult = is_z_nonpositive ?
       boost::math::cyl_bessel_j(b - 1, 2 * sqrt_z, pol) :
       boost::math::cyl_bessel_i(b - 1, 2 * sqrt_z, pol) ;
 
-    return ((boost::math::tgamma(b, pol) * sqrt_z) / sqrt_z_pow_b) * bessel_mult;
+    // Gamma(b) and z^((b - 1) / 2) finite: the prefix as it stands
+    if ((fabs(b) < boost::math::max_factorial<T>::value) &&
+        (fabs(b * log(sqrt_z)) < tools::log_max_value<T>()))
+      return ((boost::math::tgamma(b, pol) * sqrt_z) / pow(sqrt_z, b)) * bessel_mult;
+
+    if (bessel_mult == 0)
+      return bessel_mult;
+
+    // otherwise the prefix is taken by its logarithm, and the exponent
+    // of the Bessel function joins it so the two may cancel
+    int sign = 1;
+    int exp_of_bessel = 0;
+    const T mantissa = frexp(bessel_mult, &exp_of_bessel);
+    const T log_prefix = (boost::math::lgamma(b, &sign, pol) + ((1 - b) * log(sqrt_z))) +
+      (exp_of_bessel * constants::ln_two<T>());
+
+    if (log_prefix > tools::log_max_value<T>())
+      return (sign * boost::math::sign(mantissa)) * policies::raise_overflow_error<T>("boost::math::hypergeometric_0f1<%1%,%1%>(%1%, %1%)", 0, pol);
+
+    return (sign * mantissa) * exp(log_prefix);
   }
 
   } } } // namespaces
@@ -0,0 +1,408 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2014 Anton Bikineev
+//  Copyright 2014 Christopher Kormanyos
+//  Copyright 2014 John Maddock
+//  Copyright 2014 Paul Bristow
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_MATH_HYPERGEOMETRIC_1F1_DERIVATIVES_HPP
+  #define BOOST_MATH_HYPERGEOMETRIC_1F1_DERIVATIVES_HPP
+
+  #include <boost/math/policies/error_handling.hpp>
+  #include <boost/math/tools/tuple.hpp>
+  #include <boost/math/special_functions/gamma.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_asym.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_1f1_bessel.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_1f1_recurrence.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_pade.hpp>
+
+  // Joint evaluation of M = 1F1(a, b, z), dM/dz and d2M/dz2. Every term of
+  // the Taylor and asymptotic expansions is differentiated in place, so the
+  // three sums share a single pass over the terms; Kummer's transformation
+  // is differentiated by the product rule for dM/dz. The recurrences
+  // deliver the neighbouring M(a + 1, b, z) or M(a, b + 1, z) alongside M,
+  // which gives dM/dz by a contiguous relation, and d2M/dz2 follows from
+  // Kummer's equation z M'' + (b - z) M' - a M = 0 away from the origin.
+  //
+  // Not every region is a single pass. The Bessel series of 13.3.7 and
+  // 13.3.8 are not differentiated, so dM/dz costs a second evaluation of
+  // 1F1 at (a + 1, b + 1) there; d2M/dz2 costs one at (a + 2, b + 2) after
+  // Kummer's transformation and wherever |z| < 1 rules out Kummer's
+  // equation. The closed forms of hypergeometric_1f1_imp are not used,
+  // their points go to the Taylor series or the expansions instead.
+
+  namespace boost { namespace math { namespace detail {
+
+  // forward declarations for the regions without a joint kernel
+  template <class T>
+  inline bool check_hypergeometric_1f1_parameters(const T& a, const T& b);
+
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_imp(const T& a, const T& b, const T& z, const Policy& pol);
+
+  // terms u(n) = (a)n / (b)n * z^n / n! of the Taylor series together
+  // with n * u(n) and n * (n - 1) * u(n); the sums are z M' and z^2 M''
+  template <class T>
+  struct hypergeometric_1f1_derivatives_series_term
+  {
+    typedef boost::math::tuple<T, T, T> result_type;
+
+    hypergeometric_1f1_derivatives_series_term(const T& a, const T& b, const T& z)
+       : n(0), term(1), a(a), b(b), z(z)
+    {
+    }
+
+    result_type operator()()
+    {
+      const result_type r(term, n * term, (n * T(n - 1)) * term);
+      term *= (((a + n) / ((b + n) * (n + 1))) * z);
+      ++n;
+      return r;
+    }
+
+  private:
+    unsigned n;
+    T term;
+    const T a, b, z;
+  };
+
+  // terms of 2F0(b - a, 1 - a, 1 / z), each multiplied by the derivatives
+  // of e^z z^m, m = a - b - n, relative to e^z z^m itself
+  template <class T>
+  struct hypergeometric_1f1_derivatives_asym_positive_term
+  {
+    typedef boost::math::tuple<T, T, T> result_type;
+
+    hypergeometric_1f1_derivatives_asym_positive_term(const T& a, const T& b, const T& z)
+       : n(0), term(1), a(a), b(b), z(z)
+    {
+    }
+
+    result_type operator()()
+    {
+      const T m_over_z = ((a - b) - n) / z;
+      const T first = 1 + m_over_z;
+      const result_type r(term, term * first, term * ((first * first) - (m_over_z / z)));
+      term *= (((b - a) + n) * ((1 - a) + n) / (n + 1)) / z;
+      ++n;
+      return r;
+    }
+
+  private:
+    unsigned n;
+    T term;
+    const T a, b, z;
+  };
+
+  // terms of 2F0(a, 1 - b + a, -1 / z), each multiplied by the derivatives
+  // of (-z)^-m, m = a + n, relative to (-z)^-m itself
+  template <class T>
+  struct hypergeometric_1f1_derivatives_asym_negative_term
+  {
+    typedef boost::math::tuple<T, T, T> result_type;
+
+    hypergeometric_1f1_derivatives_asym_negative_term(const T& a, const T& b, const T& z)
+       : n(0), term(1), a(a), b(b), z(z)
+    {
+    }
+
+    result_type operator()()
+    {
+      const T m = a + n;
+      const result_type r(term, term * (m / -z), term * ((m * (m + 1)) / (z * z)));
+      term *= ((a + n) * ((1 - b + a) + n) / (n + 1)) / -z;
+      ++n;
+      return r;
+    }
+
+  private:
+    unsigned n;
+    T term;
+    const T a, b, z;
+  };
+
+  // sums the three streams of terms of an asymptotic expansion: stops as
+  // soon as the terms of M grow again after having decreased, and returns
+  // false unless all three streams have converged by then
+  template <class T, class Term, class Policy>
+  inline bool hypergeometric_1f1_sum_derivatives_asymptotic_series(Term& term, T& sum, T& first, T& second, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // fabs
+    using boost::math::get;
+
+    const T factor = policies::get_epsilon<T, Policy>();
+    boost::uintmax_t counter = policies::get_max_series_iterations<Policy>();
+
+    sum = first = second = 0;
+
+    T last = 0;
+    bool has_decreased = false;
+    while (counter--)
+    {
+      const typename Term::result_type t = term();
+
+      if ((fabs(get<0>(t)) <= fabs(factor * sum)) &&
+          (fabs(get<1>(t)) <= fabs(factor * first)) &&
+          (fabs(get<2>(t)) <= fabs(factor * second)))
+        return true;
+
+      if (fabs(get<0>(t)) > last)
+      {
+        if (has_decreased)
+          return false;
+      }
+      else
+        has_decreased = true;
+      last = fabs(get<0>(t));
+
+      sum += get<0>(t);
+      first += get<1>(t);
+      second += get<2>(t);
+    }
+
+    return false;
+  }
+
+  // sums the three streams of terms until each of them has converged
+  template <class T, class Term, class Policy>
+  inline void hypergeometric_1f1_sum_derivatives_series(Term& term, T& sum, T& first, T& second, const char* function, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // fabs
+    using boost::math::get;
+
+    const T factor = policies::get_epsilon<T, Policy>();
+    const boost::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+
+    sum = first = second = 0;
+
+    boost::uintmax_t counter = 0;
+    while (counter++ < max_iter)
+    {
+      const typename Term::result_type t = term();
+
+      sum += get<0>(t);
+      first += get<1>(t);
+      second += get<2>(t);
+
+      if ((fabs(get<0>(t)) <= fabs(factor * sum)) &&
+          (fabs(get<1>(t)) <= fabs(factor * first)) &&
+          (fabs(get<2>(t)) <= fabs(factor * second)))
+        break;
+    }
+
+    policies::check_series_iterations<T>(function, counter, pol);
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_derivatives_series(const T& a, const T& b, const T& z, T& first, T& second, const Policy& pol)
+  {
+    static const char* const function = "boost::math::hypergeometric_1f1_and_derivatives<%1%>(%1%,%1%,%1%)";
+
+    detail::hypergeometric_1f1_derivatives_series_term<T> s(a, b, z);
+
+    T result;
+    detail::hypergeometric_1f1_sum_derivatives_series(s, result, first, second, function, pol);
+
+    // z == 0 is handled by the caller
+    first /= z;
+    second /= (z * z);
+    return result;
+  }
+
+  // see hypergeometric_1f1_asym_positive_series
+  template <class T, class Policy>
+  inline bool hypergeometric_1f1_derivatives_asym_positive(const T& a, const T& b, const T& z, T& result, T& first, T& second, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // exp, pow
+
+    detail::hypergeometric_1f1_derivatives_asym_positive_term<T> s(a, b, z);
+
+    if (!detail::hypergeometric_1f1_sum_derivatives_asymptotic_series(s, result, first, second, pol))
+      return false;
+
+    const T gamma_ratio = (b > 0 && a > 0) ?
+      boost::math::tgamma_ratio(b, a, pol) :
+      T(boost::math::tgamma(b, pol) / boost::math::tgamma(a, pol));
+    const T prefix_a = (exp(z) * gamma_ratio) * pow(z, (a - b));
+
+    result *= prefix_a;
+    first *= prefix_a;
+    second *= prefix_a;
+    return true;
+  }
+
+  // see hypergeometric_1f1_asym_negative_series
+  template <class T, class Policy>
+  inline bool hypergeometric_1f1_derivatives_asym_negative(const T& a, const T& b, const T& z, T& result, T& first, T& second, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // pow
+
+    detail::hypergeometric_1f1_derivatives_asym_negative_term<T> s(a, b, z);
+
+    if (!detail::hypergeometric_1f1_sum_derivatives_asymptotic_series(s, result, first, second, pol))
+      return false;
+
+    const T b_minus_a = b - a;
+    const T gamma_ratio = (b > 0 && b_minus_a > 0) ?
+      boost::math::tgamma_ratio(b, b_minus_a, pol) :
+      boost::math::tgamma(b) / boost::math::tgamma((b_minus_a), pol);
+    const T prefix_b = gamma_ratio / pow(-z, a);
+
+    result *= prefix_b;
+    first *= prefix_b;
+    second *= prefix_b;
+    return true;
+  }
+
+  // the regions of hypergeometric_1f1_dispatch_imp in the same order,
+  // less the closed forms, with the Taylor series in place of Luke's
+  // rational approximation
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_derivatives_imp(const T& a, const T& b, const T& z, T& first, T& second, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // exp, fabs, ceil
+
+    static const char* const function = "boost::math::hypergeometric_1f1_and_derivatives<%1%>(%1%,%1%,%1%)";
+
+    if (a == 0)
+    {
+      first = second = 0;
+      return T(1);
+    }
+
+    // undefined result:
+    if (!detail::check_hypergeometric_1f1_parameters(a, b))
+    {
+      first = second = policies::raise_domain_error<T>(
+        function,
+        "Function is indeterminate for negative integer b = %1%.",
+        b,
+        pol);
+      return first;
+    }
+
+    if (z == 0)
+    {
+      first = a / b;
+      second = first * ((a + 1) / (b + 1));
+      return T(1);
+    }
+
+    const T b_minus_a = b - a;
+
+    // 0f0 (exp) case;
+    if (b_minus_a == 0)
+    {
+      first = second = exp(z);
+      return first;
+    }
+
+    if ((b_minus_a == -1) && !((a < 0) && (a == ceil(a))))
+    {
+      const T e = exp(z);
+      first = e * (1 + ((1 + z) / b));
+      second = e * (1 + ((2 + z) / b));
+      return e * (1 + (z / b));
+    }
+
+    // asymptotic expansion, falling through when it is not accurate enough
+    if (detail::hypergeometric_1f1_asym_region(a, b, z))
+    {
+      T result;
+      if ((b > 0) || (b != floor(b)))
+      {
+        if (((a > 0) || (a != floor(a))) && (z > 0) &&
+            detail::hypergeometric_1f1_derivatives_asym_positive(a, b, z, result, first, second, pol))
+          return result;
+
+        if (((b_minus_a > 0) || (b_minus_a != floor(b_minus_a))) && (z < 0) &&
+            detail::hypergeometric_1f1_derivatives_asym_negative(a, b, z, result, first, second, pol))
+          return result;
+      }
+    }
+
+    // the terms fall off quickly here, the Taylor series
+    // takes the place of Luke's rational approximation
+    if (fabs(b) >= fabs(100 * z))
+      return detail::hypergeometric_1f1_derivatives_series(a, b, z, first, second, pol);
+
+    if (z < -1)
+    {
+      // Kummer's transformation M(a, b, z) = e^z M(b - a, b, -z)
+      // differentiated by the product rule
+      T k_first, k_second;
+      const T k = detail::hypergeometric_1f1_derivatives_imp<T>(b_minus_a, b, -z, k_first, k_second, pol);
+      const T e = exp(z);
+
+      first = e * (k - k_first);
+
+      // the product rule for the second derivative, e^z (k - 2k' + k''),
+      // cancels as z^2 where k grows like e^-z: take the contiguous relation
+      second = ((a / b) * ((a + 1) / (b + 1))) * detail::hypergeometric_1f1_imp<T>(a + 2, b + 2, z, pol);
+
+      // agree with hypergeometric_1f1 on the value itself
+      if (a == 1)
+        return detail::hypergeometric_1f1_pade(b, z, pol);
+
+      return e * k;
+    }
+
+    T result = 0;
+    bool is_evaluated = false;
+
+    if (detail::hypergeometric_1f1_13_3_8_region(a, b, z))
+    {
+      // the Taylor series would cancel, and as in the 13.3.7 branch below
+      // no neighbour is at hand: M' = a / b M(a + 1, b + 1)
+      result = detail::hypergeometric_1f1_13_3_8_series(a, b, z, pol);
+      first = (a / b) * detail::hypergeometric_1f1_imp<T>(a + 1, b + 1, z, pol);
+      is_evaluated = true;
+    }
+    else if (detail::hypergeometric_1f1_is_a_small_enough(a))
+    {
+      const bool b_is_negative_and_greater_than_z = b < 0 ? (fabs(b) > fabs(z) ? 1 : 0) : 0;
+      if ((a == ceil(a)) && !b_is_negative_and_greater_than_z)
+      {
+        // z M' = a (M(a + 1) - M)
+        T previous = 0;
+        result = detail::hypergeometric_1f1_backward_recurrence_for_negative_a(a, b, z, pol, &previous);
+        first = (fabs(z) >= 1) ?
+          T((a * (previous - result)) / z) :
+          T((a / b) * detail::hypergeometric_1f1_imp<T>(a + 1, b + 1, z, pol));
+        is_evaluated = true;
+      }
+      else if ((2 * (z  * (b - (2 * a)))) > 0)
+      {
+        // no neighbour is at hand in the Bessel series: M' = a / b M(a + 1, b + 1)
+        result = detail::hypergeometric_1f1_13_3_7_series(a, b, z, pol);
+        first = (a / b) * detail::hypergeometric_1f1_imp<T>(a + 1, b + 1, z, pol);
+        is_evaluated = true;
+      }
+      else if (b < a)
+      {
+        // b M' = b M + (a - b) M(b + 1)
+        T previous = 0;
+        result = detail::hypergeometric_1f1_backward_recurrence_for_negative_b(a, b, z, pol, &previous);
+        first = result + ((a - b) / b) * previous;
+        is_evaluated = true;
+      }
+    }
+
+    if (is_evaluated)
+    {
+      // Kummer's equation, which cancels badly for small z
+      second = (fabs(z) >= 1) ?
+        T(((a * result) - ((b - z) * first)) / z) :
+        T(((a / b) * ((a + 1) / (b + 1))) * detail::hypergeometric_1f1_imp<T>(a + 2, b + 2, z, pol));
+      return result;
+    }
+
+    return detail::hypergeometric_1f1_derivatives_series(a, b, z, first, second, pol);
+  }
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_HYPERGEOMETRIC_1F1_DERIVATIVES_HPP
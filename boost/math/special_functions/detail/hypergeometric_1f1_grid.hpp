@@ -0,0 +1,360 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2014 Anton Bikineev
+//  Copyright 2014 Christopher Kormanyos
+//  Copyright 2014 John Maddock
+//  Copyright 2014 Paul Bristow
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_MATH_HYPERGEOMETRIC_1F1_GRID_HPP
+  #define BOOST_MATH_HYPERGEOMETRIC_1F1_GRID_HPP
+
+  #include <algorithm>
+  #include <cstddef>
+  #include <vector>
+
+  #include <boost/math/policies/error_handling.hpp>
+  #include <boost/math/tools/parallel.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_1f1_recurrence.hpp>
+
+  namespace boost { namespace math {
+
+  // storage order of the buffer filled by hypergeometric_1f1_grid:
+  // row major:    result[(i * size_b + j) * size_z + k] = 1F1(a[i], b[j], z[k]);
+  // column major: result[(k * size_b + j) * size_a + i] = 1F1(a[i], b[j], z[k]).
+  enum hypergeometric_grid_layout
+  {
+    hypergeometric_grid_row_major,
+    hypergeometric_grid_column_major
+  };
+
+  namespace detail {
+
+  // forward declaration for direct evaluation
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_imp(const T& a, const T& b, const T& z, const Policy& pol);
+
+  // distance between direct evaluations inside a recurrence run,
+  // bounds the error growth of long runs; the growth is relative
+  // and the far anchor is checked in epsilon of T, so the distance
+  // is the same for every T
+  inline unsigned hypergeometric_1f1_grid_anchor_interval()
+  {
+    return 32u;
+  }
+
+  // direct evaluation at the k-th point of a run along the a axis
+  template <class T, class Policy>
+  struct hypergeometric_1f1_grid_direct_a
+  {
+    hypergeometric_1f1_grid_direct_a(const T& a, const T& b, const T& z, const Policy& pol):
+      a(a), b(b), z(z), pol(pol)
+    {
+    }
+
+    T operator()(std::size_t k) const
+    {
+      return detail::hypergeometric_1f1_imp(T(a + static_cast<T>(k)), b, z, pol);
+    }
+
+  private:
+    const T a, b, z;
+    const Policy& pol;
+  };
+
+  // direct evaluation at the k-th point of a run along the b axis
+  template <class T, class Policy>
+  struct hypergeometric_1f1_grid_direct_b
+  {
+    hypergeometric_1f1_grid_direct_b(const T& a, const T& b, const T& z, const Policy& pol):
+      a(a), b(b), z(z), pol(pol)
+    {
+    }
+
+    T operator()(std::size_t k) const
+    {
+      return detail::hypergeometric_1f1_imp(a, T(b + static_cast<T>(k)), z, pol);
+    }
+
+  private:
+    const T a, b, z;
+    const Policy& pol;
+  };
+
+  // Picks the stable direction for a recurrence a(n)w(n+1) - b(n)w(n) + c(n)w(n-1) = 0
+  // from the ratio w(n+1)/w(n) of the wanted solution: a solution following the
+  // dominant root of a(n)t^2 - b(n)t + c(n) = 0 is walked forward, one following
+  // the minimal root backward. Returns 1, -1 or 0 when the roots are complex
+  // (equal magnitude) and no direction is preferred.
+  template <class T, class Coefficients>
+  inline int hypergeometric_1f1_grid_stable_direction(const Coefficients& coefs, const T& ratio)
+  {
+    BOOST_MATH_STD_USING // fabs, sqrt
+    using boost::math::get;
+
+    const T an = get<0>(coefs), bn = get<1>(coefs), cn = get<2>(coefs);
+    const T discriminant = (bn * bn) - (4 * (an * cn));
+
+    if ((discriminant < 0) || (an == 0))
+      return 0;
+
+    const T root_of_discriminant = sqrt(discriminant);
+    const T t1 = (bn + root_of_discriminant) / (2 * an);
+    const T t2 = (bn - root_of_discriminant) / (2 * an);
+
+    const T& dominant = fabs(t1) > fabs(t2) ? t1 : t2;
+    const T& minimal  = fabs(t1) > fabs(t2) ? t2 : t1;
+
+    return fabs(ratio - dominant) < fabs(ratio - minimal) ? 1 : -1;
+  }
+
+  // Fills w[0..n) for a unit spaced run along one parameter axis. The run is
+  // split into segments between directly evaluated anchors; inside a segment
+  // the three-term recurrence (coefficients indexed from the run start) is
+  // walked in its stable direction and the value it produces at the far anchor
+  // is compared with the direct one: a mismatch sends the segment back to
+  // direct evaluation.
+  template <class T, class Coefficients, class Direct, class Policy>
+  inline void hypergeometric_1f1_grid_walk_run(Coefficients& s, const Direct& direct, std::size_t n, T* w, const Policy&)
+  {
+    BOOST_MATH_STD_USING // fabs
+    using boost::math::get;
+    typedef typename Coefficients::result_type coef_tuple;
+
+    const std::size_t anchor_interval = detail::hypergeometric_1f1_grid_anchor_interval();
+    const T tolerance = 64 * policies::get_epsilon<T, Policy>();
+
+    w[0] = direct(0);
+
+    std::size_t i = 0;
+    while (i + 1 < n)
+    {
+      const std::size_t last = (std::min)(i + anchor_interval, n - 1);
+
+      w[i + 1] = direct(i + 1);
+      if (last == i + 1)
+      {
+        i = last;
+        continue;
+      }
+
+      w[last] = direct(last);
+      w[last - 1] = direct(last - 1);
+
+      // the preferred direction is taken from the ends of the segment, an
+      // oscillatory segment (complex roots) is walked forward; the direction
+      // may change along the run, so the walk is abandoned as soon as a step
+      // prefers the other one
+      const int direction_first = w[i] == 0 ? 0 :
+        detail::hypergeometric_1f1_grid_stable_direction(s(static_cast<boost::intmax_t>(i + 1)), T(w[i + 1] / w[i]));
+      const int direction_last = w[last - 1] == 0 ? 0 :
+        detail::hypergeometric_1f1_grid_stable_direction(s(static_cast<boost::intmax_t>(last - 1)), T(w[last] / w[last - 1]));
+
+      int direction = 0;
+      if ((direction_first >= 0) && (direction_last >= 0))
+        direction = 1;
+      else if ((direction_first <= 0) && (direction_last <= 0))
+        direction = -1;
+
+      bool is_walked = false;
+
+      if ((direction > 0) && (last > i + 3))
+      {
+        // a(n)w(n+1) = b(n)w(n) - c(n)w(n-1)
+        T current = w[i + 1], previous = w[i];
+        std::size_t k = i + 1;
+        for (; k < last; ++k)
+        {
+          const coef_tuple coefs = s(static_cast<boost::intmax_t>(k));
+          if ((previous != 0) && (detail::hypergeometric_1f1_grid_stable_direction(coefs, T(current / previous)) < 0))
+            break;
+
+          const T next = ((get<1>(coefs) * current) - (get<2>(coefs) * previous)) / get<0>(coefs);
+
+          previous = current;
+          current = next;
+
+          if (k + 2 < last)
+            w[k + 1] = next;
+        }
+
+        is_walked = (k == last) && (fabs(current - w[last]) <= fabs(tolerance * w[last]));
+      }
+      else if ((direction < 0) && (last > i + 3))
+      {
+        // c(n)w(n-1) = b(n)w(n) - a(n)w(n+1)
+        T current = w[last - 1], next = w[last];
+        std::size_t k = last - 1;
+        for (; k > i; --k)
+        {
+          const coef_tuple coefs = s(static_cast<boost::intmax_t>(k));
+          if ((current != 0) && (detail::hypergeometric_1f1_grid_stable_direction(coefs, T(next / current)) > 0))
+            break;
+
+          const T previous = ((get<1>(coefs) * current) - (get<0>(coefs) * next)) / get<2>(coefs);
+
+          next = current;
+          current = previous;
+
+          if (k - 1 > i + 1)
+            w[k - 1] = previous;
+        }
+
+        is_walked = (k == i) && (fabs(current - w[i]) <= fabs(tolerance * w[i]));
+      }
+
+      if (!is_walked)
+      {
+        for (std::size_t k = i + 2; k + 1 < last; ++k)
+          w[k] = direct(k);
+      }
+
+      i = last;
+    }
+  }
+
+  // Fills w[i] = 1F1(x[i], y, z) (or 1F1(y, x[i], z) when walking the b axis)
+  // for one line of the grid: unit spaced runs of x are walked by recurrence,
+  // everything else is evaluated directly.
+  template <class T, class Policy>
+  inline void hypergeometric_1f1_grid_line(const T* x, std::size_t size_x, const T& y, const T& z, bool is_b_axis, T* w, const Policy& pol)
+  {
+    std::size_t first = 0;
+    while (first < size_x)
+    {
+      std::size_t last = first + 1;
+      while ((last < size_x) && (x[last] - x[last - 1] == 1))
+        ++last;
+
+      const std::size_t n = last - first;
+
+      if ((n > 2) && (z != 0) && !is_b_axis)
+      {
+        detail::hypergeometric_1f1_recurrence_a_coefficients<T> s(x[first], y, z);
+        detail::hypergeometric_1f1_grid_direct_a<T, Policy> direct(x[first], y, z, pol);
+        detail::hypergeometric_1f1_grid_walk_run(s, direct, n, w + first, pol);
+      }
+      else if ((n > 2) && (z != 0))
+      {
+        detail::hypergeometric_1f1_recurrence_b_coefficients<T> s(y, x[first], z);
+        detail::hypergeometric_1f1_grid_direct_b<T, Policy> direct(y, x[first], z, pol);
+        detail::hypergeometric_1f1_grid_walk_run(s, direct, n, w + first, pol);
+      }
+      else
+      {
+        for (std::size_t i = first; i < last; ++i)
+          w[i] = is_b_axis ?
+            detail::hypergeometric_1f1_imp(y, x[i], z, pol) :
+            detail::hypergeometric_1f1_imp(x[i], y, z, pol);
+      }
+
+      first = last;
+    }
+  }
+
+  // number of points of x covered by unit spaced runs long enough to be walked
+  template <class T>
+  inline std::size_t hypergeometric_1f1_grid_walkable_points(const T* x, std::size_t size_x)
+  {
+    std::size_t result = 0, run = 1;
+    for (std::size_t i = 1; i <= size_x; ++i)
+    {
+      if ((i < size_x) && (x[i] - x[i - 1] == 1))
+      {
+        ++run;
+        continue;
+      }
+      if (run > 2)
+        result += run;
+      run = 1;
+    }
+    return result;
+  }
+
+  // evaluates the grid for the b indices [first_b, last_b),
+  // results are narrowed to ResultType on the way out
+  template <class T, class ResultType, class RandomAccessIterator, class Policy>
+  struct hypergeometric_1f1_grid_task
+  {
+    hypergeometric_1f1_grid_task(const std::vector<T>& a, const std::vector<T>& b, const std::vector<T>& z,
+                                 RandomAccessIterator result, hypergeometric_grid_layout layout, const Policy& pol):
+      a(a), b(b), z(z), result(result), layout(layout), pol(pol)
+    {
+    }
+
+    void operator()(std::size_t first_b, std::size_t last_b)
+    {
+      const std::size_t size_a = a.size(), size_z = z.size();
+      const std::size_t size_b_chunk = last_b - first_b;
+
+      // walk the axis whose runs cover more points; runs along b
+      // are cut at the chunk boundaries of the thread split
+      const bool is_b_axis =
+        detail::hypergeometric_1f1_grid_walkable_points(&b[first_b], size_b_chunk) >
+        detail::hypergeometric_1f1_grid_walkable_points(&a[0], size_a);
+
+      std::vector<T> line(is_b_axis ? size_b_chunk : size_a);
+
+      for (std::size_t k = 0; k < size_z; ++k)
+      {
+        if (is_b_axis)
+        {
+          for (std::size_t i = 0; i < size_a; ++i)
+          {
+            detail::hypergeometric_1f1_grid_line(&b[first_b], size_b_chunk, a[i], z[k], true, &line[0], pol);
+
+            for (std::size_t j = first_b; j < last_b; ++j)
+              store(i, j, k, line[j - first_b]);
+          }
+        }
+        else
+        {
+          for (std::size_t j = first_b; j < last_b; ++j)
+          {
+            detail::hypergeometric_1f1_grid_line(&a[0], size_a, b[j], z[k], false, &line[0], pol);
+
+            for (std::size_t i = 0; i < size_a; ++i)
+              store(i, j, k, line[i]);
+          }
+        }
+      }
+    }
+
+  private:
+    void store(std::size_t i, std::size_t j, std::size_t k, const T& value)
+    {
+      const std::size_t index = (layout == hypergeometric_grid_row_major) ?
+        ((i * b.size()) + j) * z.size() + k :
+        ((k * b.size()) + j) * a.size() + i;
+
+      result[index] = policies::checked_narrowing_cast<ResultType, Policy>(
+        value,
+        "boost::math::hypergeometric_1f1_grid<%1%>(%1%,%1%,%1%)");
+    }
+
+    const std::vector<T>& a;
+    const std::vector<T>& b;
+    const std::vector<T>& z;
+    RandomAccessIterator result;
+    const hypergeometric_grid_layout layout;
+    const Policy& pol;
+  };
+
+  template <class T, class ResultType, class RandomAccessIterator, class Policy>
+  inline void hypergeometric_1f1_grid_imp(const std::vector<T>& a, const std::vector<T>& b, const std::vector<T>& z,
+                                          RandomAccessIterator result, hypergeometric_grid_layout layout, unsigned threads, const Policy& pol)
+  {
+    if (a.empty() || b.empty() || z.empty())
+      return;
+
+    // every b index owns a disjoint set of output elements,
+    // so the b axis is split between threads
+    detail::hypergeometric_1f1_grid_task<T, ResultType, RandomAccessIterator, Policy> task(a, b, z, result, layout, pol);
+    tools::parallel_for_chunks(b.size(), threads, task);
+  }
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_HYPERGEOMETRIC_1F1_GRID_HPP
@@ -0,0 +1,444 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2014 Anton Bikineev
+//  Copyright 2014 Christopher Kormanyos
+//  Copyright 2014 John Maddock
+//  Copyright 2014 Paul Bristow
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_MATH_HYPERGEOMETRIC_1F1_PARAMETER_DERIVATIVES_HPP
+  #define BOOST_MATH_HYPERGEOMETRIC_1F1_PARAMETER_DERIVATIVES_HPP
+
+  #include <boost/math/policies/error_handling.hpp>
+  #include <boost/math/tools/tuple.hpp>
+  #include <boost/math/special_functions/gamma.hpp>
+  #include <boost/math/special_functions/digamma.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_1f1_derivatives.hpp>
+
+  // Joint evaluation of M = 1F1(a, b, z), dM/da and dM/db. A term u(n)
+  // of the Taylor or asymptotic series is built as u(n + 1) = u(n) r(n),
+  // so its derivative follows as d(n + 1) = d(n) r(n) + u(n) r'(n): these
+  // are the digamma weighted terms u(n) (psi(a + n) - psi(a)) without
+  // any digamma evaluations, and they stay correct past the zero factor
+  // of a non-positive integer a, where M terminates but dM/da does not.
+  // The asymptotic prefixes add digamma and log terms, Kummer's
+  // transformation goes by the chain rule, and the backward recurrences
+  // are differentiated into inhomogeneous recurrences walked alongside.
+
+  namespace boost { namespace math { namespace detail {
+
+  // u(n) = (a)n / (b)n * z^n / n! with its a- and b-derivatives
+  template <class T>
+  struct hypergeometric_1f1_parameter_derivatives_series_term
+  {
+    typedef boost::math::tuple<T, T, T> result_type;
+
+    hypergeometric_1f1_parameter_derivatives_series_term(const T& a, const T& b, const T& z)
+       : n(0), term(1), term_da(0), term_db(0), a(a), b(b), z(z)
+    {
+    }
+
+    result_type operator()()
+    {
+      const result_type r(term, term_da, term_db);
+
+      const T ratio_da = z / ((b + n) * (n + 1));
+      const T ratio = (a + n) * ratio_da;
+      const T ratio_db = -ratio / (b + n);
+
+      term_da = (term_da * ratio) + (term * ratio_da);
+      term_db = (term_db * ratio) + (term * ratio_db);
+      term *= ratio;
+      ++n;
+      return r;
+    }
+
+  private:
+    unsigned n;
+    T term, term_da, term_db;
+    const T a, b, z;
+  };
+
+  // terms of 2F0(b - a, 1 - a, 1 / z) with their a- and b-derivatives
+  template <class T>
+  struct hypergeometric_1f1_parameter_derivatives_asym_positive_term
+  {
+    typedef boost::math::tuple<T, T, T> result_type;
+
+    hypergeometric_1f1_parameter_derivatives_asym_positive_term(const T& a, const T& b, const T& z)
+       : n(0), term(1), term_da(0), term_db(0), a(a), b(b), z(z)
+    {
+    }
+
+    result_type operator()()
+    {
+      const result_type r(term, term_da, term_db);
+
+      const T scale = 1 / ((n + 1) * z);
+      const T ratio = ((b - a) + n) * ((1 - a) + n) * scale;
+      const T ratio_da = -(((b - a) + n) + ((1 - a) + n)) * scale;
+      const T ratio_db = ((1 - a) + n) * scale;
+
+      term_da = (term_da * ratio) + (term * ratio_da);
+      term_db = (term_db * ratio) + (term * ratio_db);
+      term *= ratio;
+      ++n;
+      return r;
+    }
+
+  private:
+    unsigned n;
+    T term, term_da, term_db;
+    const T a, b, z;
+  };
+
+  // terms of 2F0(a, 1 - b + a, -1 / z) with their a- and b-derivatives
+  template <class T>
+  struct hypergeometric_1f1_parameter_derivatives_asym_negative_term
+  {
+    typedef boost::math::tuple<T, T, T> result_type;
+
+    hypergeometric_1f1_parameter_derivatives_asym_negative_term(const T& a, const T& b, const T& z)
+       : n(0), term(1), term_da(0), term_db(0), a(a), b(b), z(z)
+    {
+    }
+
+    result_type operator()()
+    {
+      const result_type r(term, term_da, term_db);
+
+      const T scale = 1 / ((n + 1) * -z);
+      const T ratio = (a + n) * ((1 - b + a) + n) * scale;
+      const T ratio_da = ((a + n) + ((1 - b + a) + n)) * scale;
+      const T ratio_db = -(a + n) * scale;
+
+      term_da = (term_da * ratio) + (term * ratio_da);
+      term_db = (term_db * ratio) + (term * ratio_db);
+      term *= ratio;
+      ++n;
+      return r;
+    }
+
+  private:
+    unsigned n;
+    T term, term_da, term_db;
+    const T a, b, z;
+  };
+
+  // a- and b-derivatives of the coefficients of
+  // hypergeometric_1f1_recurrence_a_coefficients
+  template <class T>
+  struct hypergeometric_1f1_recurrence_a_coefficients_derivatives
+  {
+    typedef boost::math::tuple<T, T, T, T, T, T> result_type;
+
+    result_type operator()(boost::intmax_t) const
+    {
+      return result_type(-1, -2, -1, 0, 1, 1);
+    }
+  };
+
+  // a- and b-derivatives of the coefficients of
+  // hypergeometric_1f1_recurrence_b_coefficients
+  template <class T>
+  struct hypergeometric_1f1_recurrence_b_coefficients_derivatives
+  {
+    typedef boost::math::tuple<T, T, T, T, T, T> result_type;
+
+    hypergeometric_1f1_recurrence_b_coefficients_derivatives(const T& b, const T& z):
+    b(b), z(z)
+    {
+    }
+
+    result_type operator()(boost::intmax_t i) const
+    {
+      const T bi = b + i;
+
+      return result_type(-z, 0, 0, z, (z + (2 * bi)) - 1, (2 * bi) - 1);
+    }
+
+  private:
+    const T b, z;
+  };
+
+  // tools::solve_recurrence_relation_backward walked together with the
+  // derivatives of w with respect to the parameters: differentiating
+  // a(n)w(n+1) - b(n)w(n) + c(n)w(n-1) = 0 gives the same recurrence for
+  // the derivatives, driven by -(a'(n)w(n+1) - b'(n)w(n) + c'(n)w(n-1)).
+  //
+  // The direction is stable for w, but not necessarily for the derivatives:
+  // rounding errors in them grow like w itself, so their error is a few
+  // epsilon of |w| times the ratio of the derivatives to w at the seeds,
+  // rather than of themselves, where they shrink against w along the walk.
+  template <class T, class Coefficients, class CoefficientsDerivatives>
+  inline T hypergeometric_1f1_differentiated_backward_recurrence(Coefficients& get_coefs, CoefficientsDerivatives& get_derivatives, unsigned last_index,
+                                                                 T first, T second, T first_da, T second_da, T first_db, T second_db,
+                                                                 T& da, T& db)
+  {
+    using std::swap;
+    using boost::math::get;
+
+    for (unsigned k = 0; k < last_index; ++k)
+    {
+      const typename Coefficients::result_type next = get_coefs(-static_cast<int>(k));
+      const typename CoefficientsDerivatives::result_type derivatives = get_derivatives(-static_cast<int>(k));
+
+      const T an = get<0>(next), bn = get<1>(next), inverse_cn = 1 / get<2>(next);
+
+      T third = ((bn * second) - (an * first)) * inverse_cn;
+      T third_da = (((bn * second_da) - (an * first_da)) -
+                   (((get<0>(derivatives) * first) - (get<1>(derivatives) * second)) + (get<2>(derivatives) * third))) * inverse_cn;
+      T third_db = (((bn * second_db) - (an * first_db)) -
+                   (((get<3>(derivatives) * first) - (get<4>(derivatives) * second)) + (get<5>(derivatives) * third))) * inverse_cn;
+
+      swap(first, second); swap(second, third);
+      swap(first_da, second_da); swap(second_da, third_da);
+      swap(first_db, second_db); swap(second_db, third_db);
+    }
+
+    da = first_da;
+    db = first_db;
+    return first;
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_parameter_derivatives_imp(const T& a, const T& b, const T& z, T& da, T& db, const Policy& pol);
+
+  // see hypergeometric_1f1_backward_recurrence_for_negative_a, the walk
+  // starts at ak and covers -integer_part steps
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_parameter_derivatives_backward_a(T ak, boost::intmax_t integer_part, const T& b, const T& z, T& da, T& db, const Policy& pol)
+  {
+    T first_da, first_db, second_da, second_db;
+    const T first = detail::hypergeometric_1f1_parameter_derivatives_imp(ak, b, z, first_da, first_db, pol);
+    --ak;
+    const T second = detail::hypergeometric_1f1_parameter_derivatives_imp(ak, b, z, second_da, second_db, pol);
+
+    detail::hypergeometric_1f1_recurrence_a_coefficients<T> s(ak, b, z);
+    detail::hypergeometric_1f1_recurrence_a_coefficients_derivatives<T> d;
+
+    return detail::hypergeometric_1f1_differentiated_backward_recurrence(s, d,
+                                                                         static_cast<unsigned int>(std::abs(integer_part)),
+                                                                         first, second, first_da, second_da, first_db, second_db,
+                                                                         da, db);
+  }
+
+  // the walk down the recurrence on b from bk to bk - steps
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_parameter_derivatives_backward_b_from(const T& a, T bk, unsigned steps, const T& z, T& da, T& db, const Policy& pol)
+  {
+    T first_da, first_db, second_da, second_db;
+    const T first = detail::hypergeometric_1f1_parameter_derivatives_imp(a, bk, z, first_da, first_db, pol);
+    --bk;
+    const T second = detail::hypergeometric_1f1_parameter_derivatives_imp(a, bk, z, second_da, second_db, pol);
+
+    detail::hypergeometric_1f1_recurrence_b_coefficients<T> s(a, bk, z);
+    detail::hypergeometric_1f1_recurrence_b_coefficients_derivatives<T> d(bk, z);
+
+    return detail::hypergeometric_1f1_differentiated_backward_recurrence(s, d, steps,
+                                                                         first, second, first_da, second_da, first_db, second_db,
+                                                                         da, db);
+  }
+
+  // see hypergeometric_1f1_backward_recurrence_for_negative_b
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_parameter_derivatives_backward_b(const T& a, const T& b, const T& z, T& da, T& db, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // modf
+
+    boost::intmax_t integer_part = 0;
+    const T bk = modf(b, &integer_part);
+
+    return detail::hypergeometric_1f1_parameter_derivatives_backward_b_from(a, bk, static_cast<unsigned>(std::abs(integer_part)), z, da, db, pol);
+  }
+
+  // M(a, b + k, z) tends to 1 as k grows, the minimal solution of the
+  // recurrence on b, so the walk down from where the Taylor series
+  // takes over, |b| >= 100 |z|, is stable for M
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_parameter_derivatives_from_large_b(const T& a, const T& b, const T& z, T& da, T& db, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // ceil, fabs
+
+    const T distance = ceil((100 * fabs(z)) - b);
+    const unsigned steps = (distance > 0 ? boost::math::itrunc(distance, pol) : 0) + 1u;
+
+    return detail::hypergeometric_1f1_parameter_derivatives_backward_b_from(a, T(b + steps), steps, z, da, db, pol);
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_parameter_derivatives_series(const T& a, const T& b, const T& z, T& da, T& db, const Policy& pol)
+  {
+    static const char* const function = "boost::math::hypergeometric_1f1_and_parameter_derivatives<%1%>(%1%,%1%,%1%)";
+
+    detail::hypergeometric_1f1_parameter_derivatives_series_term<T> s(a, b, z);
+
+    T result;
+    detail::hypergeometric_1f1_sum_derivatives_series(s, result, da, db, function, pol);
+    return result;
+  }
+
+  // see hypergeometric_1f1_asym_positive_series, the prefix
+  // contributes log(z) - psi(a) and psi(b) - log(z)
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_parameter_derivatives_asym_positive(const T& a, const T& b, const T& z, T& da, T& db, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // exp, pow, log
+    static const char* const function = "boost::math::hypergeometric_1f1_and_parameter_derivatives<%1%>(%1%,%1%,%1%)";
+
+    const T gamma_ratio = (b > 0 && a > 0) ?
+      boost::math::tgamma_ratio(b, a, pol) :
+      T(boost::math::tgamma(b, pol) / boost::math::tgamma(a, pol));
+    const T prefix_a = (exp(z) * gamma_ratio) * pow(z, (a - b));
+
+    detail::hypergeometric_1f1_parameter_derivatives_asym_positive_term<T> s(a, b, z);
+
+    T result;
+    detail::hypergeometric_1f1_sum_derivatives_series(s, result, da, db, function, pol);
+
+    const T log_z = log(z);
+    da = prefix_a * ((result * (log_z - boost::math::digamma(a, pol))) + da);
+    db = prefix_a * ((result * (boost::math::digamma(b, pol) - log_z)) + db);
+    return prefix_a * result;
+  }
+
+  // see hypergeometric_1f1_asym_negative_series, the prefix
+  // contributes psi(b - a) - log(-z) and psi(b) - psi(b - a)
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_parameter_derivatives_asym_negative(const T& a, const T& b, const T& z, T& da, T& db, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // pow, log
+    static const char* const function = "boost::math::hypergeometric_1f1_and_parameter_derivatives<%1%>(%1%,%1%,%1%)";
+
+    const T b_minus_a = b - a;
+    const T gamma_ratio = (b > 0 && b_minus_a > 0) ?
+      boost::math::tgamma_ratio(b, b_minus_a, pol) :
+      boost::math::tgamma(b) / boost::math::tgamma((b_minus_a), pol);
+    const T prefix_b = gamma_ratio / pow(-z, a);
+
+    detail::hypergeometric_1f1_parameter_derivatives_asym_negative_term<T> s(a, b, z);
+
+    T result;
+    detail::hypergeometric_1f1_sum_derivatives_series(s, result, da, db, function, pol);
+
+    const T digamma_b_minus_a = boost::math::digamma(b_minus_a, pol);
+    da = prefix_b * ((result * (digamma_b_minus_a - log(-z))) + da);
+    db = prefix_b * ((result * (boost::math::digamma(b, pol) - digamma_b_minus_a)) + db);
+    return prefix_b * result;
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_parameter_derivatives_dispatch(const T& a, const T& b, const T& z, T& da, T& db, const Policy& pol);
+
+  // the shortcuts of hypergeometric_1f1_imp for special parameters do not
+  // carry over, since the derivatives leave the special line b == a etc.
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_parameter_derivatives_imp(const T& a, const T& b, const T& z, T& da, T& db, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // floor
+
+    static const char* const function = "boost::math::hypergeometric_1f1_and_parameter_derivatives<%1%>(%1%,%1%,%1%)";
+
+    if (z == 0)
+    {
+      da = db = 0;
+      return T(1);
+    }
+
+    // undefined result, and M is not differentiable even
+    // where it is a polynomial over a polynomial:
+    if ((b <= 0) && (b == floor(b)))
+    {
+      da = db = policies::raise_domain_error<T>(
+        function,
+        "Derivatives are indeterminate for non-positive integer b = %1%.",
+        b,
+        pol);
+      return da;
+    }
+
+    // M(0, b, z) == 1 for all b, only dM/da is left
+    if (a == 0)
+    {
+      T unused;
+      detail::hypergeometric_1f1_parameter_derivatives_dispatch(a, b, z, da, unused, pol);
+      db = 0;
+      return T(1);
+    }
+
+    return detail::hypergeometric_1f1_parameter_derivatives_dispatch(a, b, z, da, db, pol);
+  }
+
+  // the region selection of hypergeometric_1f1_imp, with
+  // differentiable kernels in place of the Bessel series
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_parameter_derivatives_dispatch(const T& a, const T& b, const T& z, T& da, T& db, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // exp, fabs, floor, ceil
+
+    const T b_minus_a = b - a;
+
+    // asymptotic expansion
+    if (detail::hypergeometric_1f1_asym_region(a, b, z))
+    {
+      if (((a > 0) || (a != floor(a))) && (z > 0))
+        return detail::hypergeometric_1f1_parameter_derivatives_asym_positive(a, b, z, da, db, pol);
+
+      if (((b_minus_a > 0) || (b_minus_a != floor(b_minus_a))) && (z < 0))
+        return detail::hypergeometric_1f1_parameter_derivatives_asym_negative(a, b, z, da, db, pol);
+    }
+
+    // the terms fall off quickly here, the Taylor series
+    // takes the place of Luke's rational approximation
+    if (fabs(b) >= fabs(100 * z))
+      return detail::hypergeometric_1f1_parameter_derivatives_series(a, b, z, da, db, pol);
+
+    if (z < -1)
+    {
+      // Kummer's transformation M(a, b, z) = e^z K(b - a, b, -z)
+      // differentiated by the chain rule
+      T k_dc, k_db;
+      const T k = detail::hypergeometric_1f1_parameter_derivatives_imp<T>(b_minus_a, b, -z, k_dc, k_db, pol);
+      const T e = exp(z);
+
+      da = -e * k_dc;
+      db = e * (k_dc + k_db);
+
+      // agree with hypergeometric_1f1 on the value itself
+      if (a == 1)
+        return detail::hypergeometric_1f1_pade(b, z, pol);
+
+      return e * k;
+    }
+
+    if (detail::hypergeometric_1f1_is_a_small_enough(a))
+    {
+      const bool b_is_negative_and_greater_than_z = b < 0 ? (fabs(b) > fabs(z) ? 1 : 0) : 0;
+      if ((a == ceil(a)) && !b_is_negative_and_greater_than_z)
+      {
+        boost::intmax_t integer_part = 0;
+        const T ak = detail::hypergeometric_1f1_negative_a_recurrence_start(a, b, integer_part);
+        return detail::hypergeometric_1f1_parameter_derivatives_backward_a(ak, integer_part, b, z, da, db, pol);
+      }
+      else if ((2 * (z  * (b - (2 * a)))) > 0)
+      {
+        // hypergeometric_1f1_imp takes the 13_3_7 series here, which has
+        // no b-derivative without that of J in its order; the Taylor
+        // series does for z in [-1, 0), the walk down in b for z > 0
+        if (z < 0)
+          return detail::hypergeometric_1f1_parameter_derivatives_series(a, b, z, da, db, pol);
+
+        return detail::hypergeometric_1f1_parameter_derivatives_from_large_b(a, b, z, da, db, pol);
+      }
+      else if (b < a)
+        return detail::hypergeometric_1f1_parameter_derivatives_backward_b(a, b, z, da, db, pol);
+    }
+
+    return detail::hypergeometric_1f1_parameter_derivatives_series(a, b, z, da, db, pol);
+  }
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_HYPERGEOMETRIC_1F1_PARAMETER_DERIVATIVES_HPP
@@ -13,6 +13,8 @@
 
   #include <boost/math/special_functions/modf.hpp>
   #include <boost/math/special_functions/next.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_series.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_1f1_bessel.hpp>
 
   #include <boost/math/tools/recurrence.hpp>
 
@@ -94,16 +96,56 @@
     const T a, b, z;
   };
 
-  // forward declaration for initial values
+  // what hypergeometric_1f1_dispatch_imp leaves over
+  enum hypergeometric_1f1_series_kind
+  {
+    hypergeometric_1f1_evaluated, // nothing, the result is at hand
+    hypergeometric_1f1_by_13_3_8, // the Bessel series of A&S 13.3.8
+    hypergeometric_1f1_by_taylor  // the plain series
+  };
+
+  // forward declarations for initial values
   template <class T, class Policy>
-  inline T hypergeometric_1f1_imp(const T& a, const T& b, const T& z, const Policy& pol);
+  inline hypergeometric_1f1_series_kind hypergeometric_1f1_dispatch_imp(const T& a, const T& b, const T& z, T& result, const Policy& pol);
 
   template <class T, class Policy>
-  inline T hypergeometric_1f1_backward_recurrence_for_negative_a(const T& a, const T& b, const T& z, const Policy& pol)
+  inline T hypergeometric_1f1_series_imp(const hypergeometric_1f1_series_kind kind, const T& a, const T& b, const T& z, const Policy& pol);
+
+  // the two initial values of a recurrence, 1F1(a, b, z) and, in
+  // neighbour, 1F1(a_neighbour, b_neighbour, z): hypergeometric_1f1_imp
+  // for both, except that where both come down to the same series it
+  // is evaluated for the two at once, in one loop over the terms and,
+  // for 13_3_8 with b and b - 1, on one sequence of Bessel functions
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_recurrence_seeds(const T& a, const T& b, const T& a_neighbour, const T& b_neighbour, const T& z, T& neighbour, const Policy& pol)
+  {
+    T result;
+    const hypergeometric_1f1_series_kind kind = detail::hypergeometric_1f1_dispatch_imp(a, b, z, result, pol);
+    const hypergeometric_1f1_series_kind neighbour_kind = detail::hypergeometric_1f1_dispatch_imp(a_neighbour, b_neighbour, z, neighbour, pol);
+
+    if ((kind == hypergeometric_1f1_by_taylor) && (neighbour_kind == hypergeometric_1f1_by_taylor))
+      return detail::hypergeometric_1f1_generic_series_pair(a, b, a_neighbour, b_neighbour, z, neighbour, pol);
+
+    if ((kind == hypergeometric_1f1_by_13_3_8) && (neighbour_kind == hypergeometric_1f1_by_13_3_8) &&
+        (a_neighbour == a) && (b_neighbour == b - 1))
+      return detail::hypergeometric_1f1_13_3_8_series_pair(a, b, z, neighbour, pol);
+
+    if (kind != hypergeometric_1f1_evaluated)
+      result = detail::hypergeometric_1f1_series_imp(kind, a, b, z, pol);
+
+    if (neighbour_kind != hypergeometric_1f1_evaluated)
+      neighbour = detail::hypergeometric_1f1_series_imp(neighbour_kind, a_neighbour, b_neighbour, z, pol);
+
+    return result;
+  }
+
+  // starting point of the backward recurrence on a,
+  // integer_part receives minus the number of steps
+  template <class T>
+  inline T hypergeometric_1f1_negative_a_recurrence_start(const T& a, const T& b, boost::intmax_t& integer_part)
   {
     BOOST_MATH_STD_USING // modf, frexp, fabs, pow
 
-    boost::intmax_t integer_part = 0;
     const T bk = modf(b, &integer_part);
     T ak = modf(a, &integer_part);
 
@@ -113,22 +155,33 @@
     const bool are_fractional_parts_close_enough =
       fabs(boost::math::float_distance(ak, bk)) <= pow(2, (std::max)(exp_of_a, exp_of_b));
 
-    if ((a < b) && (b < 0) && (are_fractional_parts_close_enough)) // TODO: has to be researched deeper
+    // the coefficient b - a of the recurrence, which the walk down divides
+    // by, vanishes where a passes b: with the fractional parts the same to
+    // within the rounding of either, a walk from modf(a) would meet that
+    // zero, or come close enough to lose all digits, so it starts below b
+    if ((a < b) && (b < 0) && (are_fractional_parts_close_enough))
     {
       ak = b - 1;
       integer_part -= (boost::math::lltrunc(ceil(b)) - 1);
     }
 
-    T first = detail::hypergeometric_1f1_imp(ak, b, z, pol);
+    return ak;
+  }
+
+  // previous: if not null, receives 1F1(a + 1, b, z)
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_backward_recurrence_for_negative_a(const T& a, const T& b, const T& z, const Policy& pol, T* previous = 0)
+  {
+    boost::intmax_t integer_part = 0;
+    T ak = detail::hypergeometric_1f1_negative_a_recurrence_start(a, b, integer_part);
+
+    T second;
+    T first = detail::hypergeometric_1f1_recurrence_seeds(ak, b, T(ak - 1), b, z, second, pol);
     --ak;
-    T second = detail::hypergeometric_1f1_imp(ak, b, z, pol);
 
     detail::hypergeometric_1f1_recurrence_a_coefficients<T> s(ak, b, z);
 
-    return tools::solve_recurrence_relation_backward(s,
-                                                     static_cast<unsigned int>(std::abs(integer_part)),
-                                                     first,
-                                                     second);
+    return tools::solve_recurrence_relation(s, -static_cast<boost::intmax_t>(std::abs(integer_part)), first, second, static_cast<T*>(0), static_cast<tools::recurrence_method*>(0), previous);
   }
 
   template <class T, class Policy>
@@ -139,33 +192,31 @@
     boost::intmax_t integer_part = 0;
     T ak = modf(a, &integer_part);
 
-    T first = detail::hypergeometric_1f1_imp(ak, b, z, pol);
+    T second;
+    T first = detail::hypergeometric_1f1_recurrence_seeds(ak, b, T(ak + 1), b, z, second, pol);
     ++ak;
-    T second = detail::hypergeometric_1f1_imp(ak, b, z, pol);
 
     detail::hypergeometric_1f1_recurrence_a_coefficients<T> s(ak, b, z);
 
-    return tools::solve_recurrence_relation_forward(s, integer_part, first, second);
+    return tools::solve_recurrence_relation(s, integer_part, first, second);
   }
 
+  // previous: if not null, receives 1F1(a, b + 1, z)
   template <class T, class Policy>
-  inline T hypergeometric_1f1_backward_recurrence_for_negative_b(const T& a, const T& b, const T& z, const Policy& pol)
+  inline T hypergeometric_1f1_backward_recurrence_for_negative_b(const T& a, const T& b, const T& z, const Policy& pol, T* previous = 0)
   {
     BOOST_MATH_STD_USING // modf, fabs
 
     boost::intmax_t integer_part = 0;
     T bk = modf(b, &integer_part);
 
-    T first = detail::hypergeometric_1f1_imp(a, bk, z, pol);
+    T second;
+    T first = detail::hypergeometric_1f1_recurrence_seeds(a, bk, a, T(bk - 1), z, second, pol);
     --bk;
-    T second = detail::hypergeometric_1f1_imp(a, bk, z, pol);
 
     detail::hypergeometric_1f1_recurrence_b_coefficients<T> s(a, bk, z);
 
-    return tools::solve_recurrence_relation_backward(s,
-                                                     static_cast<unsigned int>(std::abs(integer_part)),
-                                                     first,
-                                                     second);
+    return tools::solve_recurrence_relation(s, -static_cast<boost::intmax_t>(std::abs(integer_part)), first, second, static_cast<T*>(0), static_cast<tools::recurrence_method*>(0), previous);
   }
 
   // this method works provided that integer part of a is the same as integer part of b
@@ -179,13 +230,13 @@
     T ak = modf(a, &integer_part);
     T bk = modf(b, &integer_part);
 
-    T first = detail::hypergeometric_1f1_imp(ak, bk, z, pol);
+    T second;
+    T first = detail::hypergeometric_1f1_recurrence_seeds(ak, bk, T(ak - 1), T(bk - 1), z, second, pol);
     --ak; --bk;
-    T second = detail::hypergeometric_1f1_imp(ak, bk, z, pol);
 
     detail::hypergeometric_1f1_recurrence_a_and_b_coefficients<T> s(ak, bk, z);
 
-    return tools::solve_recurrence_relation_backward(s, fabs(integer_part), first, second);
+    return tools::solve_recurrence_relation(s, -static_cast<boost::intmax_t>(std::abs(integer_part)), first, second);
   }
 
   // ranges
@@ -0,0 +1,379 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2014 Anton Bikineev
+//  Copyright 2014 Christopher Kormanyos
+//  Copyright 2014 John Maddock
+//  Copyright 2014 Paul Bristow
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_MATH_HYPERGEOMETRIC_1F1_SWEEP_HPP
+  #define BOOST_MATH_HYPERGEOMETRIC_1F1_SWEEP_HPP
+
+  #include <algorithm>
+  #include <cstddef>
+  #include <iterator>
+  #include <utility>
+  #include <vector>
+
+  #include <boost/math/policies/error_handling.hpp>
+  #include <boost/math/tools/parallel.hpp>
+  #include <boost/math/tools/precision.hpp>
+  #include <boost/math/special_functions/fpclassify.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_1f1_derivatives.hpp>
+
+  // Evaluation of z -> 1F1(a, b, z) over many points at fixed parameters.
+  // M solves Kummer's equation z M'' + (b - z) M' - a M = 0, so M and M' at
+  // one point give its Taylor coefficients there by a short recurrence, and
+  // the Taylor polynomial gives M at every point within the step, and M and
+  // M' at the next centre. The points are walked outwards from z = 0, where
+  // the equation is singular, in steps chosen from the decay of the
+  // coefficients. Every so many steps M is evaluated directly: it replaces
+  // the propagated value, and a mismatch between the two sends the points
+  // walked since the previous anchor back to direct evaluation. Errors are
+  // amplified where the walk runs against a dominant solution, as away from
+  // z = 0 for b < 1 or towards the zeros of a polynomial M, and the checks
+  // then come at every step.
+
+  namespace boost { namespace math { namespace detail {
+
+  // forward declarations for direct evaluation
+  template <class T>
+  inline bool check_hypergeometric_1f1_parameters(const T& a, const T& b);
+
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_imp(const T& a, const T& b, const T& z, const Policy& pol);
+
+  // most Taylor steps between direct evaluations; every anchor is
+  // checked in epsilon of T, so the cap is the same for every T
+  inline unsigned hypergeometric_1f1_sweep_anchor_interval()
+  {
+    return 32u;
+  }
+
+  // degree of the Taylor polynomials for a target precision of ResultType:
+  // a third of its digits, the step shrinks as the degree drops and every
+  // point costs as many multiplications
+  template <class ResultType>
+  inline unsigned hypergeometric_1f1_sweep_order()
+  {
+    return (std::max)(8, boost::math::tools::digits<ResultType>() / 3);
+  }
+
+  // f[n] = M^(n)(z0) / n! for n <= order from f[0] = M(z0) and f[1] = M'(z0);
+  // Kummer's equation differentiated n times gives
+  // z0 (n + 2)(n + 1) f[n + 2] = (a + n) f[n] - (b + n - z0)(n + 1) f[n + 1],
+  // and at z0 = 0 the solution regular there has f[n + 1] = f[n] (a + n) / ((b + n)(n + 1))
+  template <class T>
+  inline void hypergeometric_1f1_sweep_taylor(const T& a, const T& b, const T& z0, T* f, const unsigned order)
+  {
+    if (z0 == 0)
+    {
+      for (unsigned n = 0; n < order; ++n)
+        f[n + 1] = f[n] * ((a + n) / ((b + n) * (n + 1)));
+      return;
+    }
+
+    for (unsigned n = 0; n + 1 < order; ++n)
+      f[n + 2] = (((a + n) * f[n]) - (((b + n) - z0) * (n + 1)) * f[n + 1]) / ((z0 * (n + 2)) * (n + 1));
+  }
+
+  // the step over which the Taylor polynomial reproduces M to tolerance,
+  // from its last two coefficients, and at most half the distance to the
+  // singular point z = 0: the recurrence above excites the solution
+  // singular there, whose coefficients grow as |z0|^-n
+  template <class T>
+  inline T hypergeometric_1f1_sweep_step(const T* f, const unsigned order, const T& z0, const T& tolerance)
+  {
+    BOOST_MATH_STD_USING // fabs, pow
+
+    // f[0] alone would stop the walk at a zero of M
+    const T norm = (std::max)(fabs(f[0]), fabs(f[1]));
+
+    T step = boost::math::tools::max_value<T>();
+    for (unsigned n = order - 1u; n <= order; ++n)
+      if (f[n] != 0)
+        step = (std::min)(step, T(pow(T(tolerance * norm / fabs(f[n])), T(1) / n)));
+
+    if (z0 != 0)
+      step = (std::min)(step, T(fabs(z0) / 2));
+
+    return step;
+  }
+
+  // the Taylor polynomial and its derivative at z0 + t
+  template <class T>
+  inline T hypergeometric_1f1_sweep_polynomial(const T* f, const unsigned order, const T& t, T& derivative)
+  {
+    T value = f[order];
+    derivative = 0;
+    for (unsigned n = order; n > 0u; --n)
+    {
+      derivative = (derivative * t) + value;
+      value = (value * t) + f[n - 1u];
+    }
+
+    return value;
+  }
+
+  template <class T>
+  inline T hypergeometric_1f1_sweep_polynomial(const T* f, const unsigned order, const T& t)
+  {
+    T value = f[order];
+    for (unsigned n = order; n > 0u; --n)
+      value = (value * t) + f[n - 1u];
+
+    return value;
+  }
+
+  // the Taylor polynomial at two points at once: two independent chains
+  // hide the latency of Horner's rule, more lanes would spill the x87
+  // register stack when T is long double, as it is for double results
+  template <class T>
+  inline void hypergeometric_1f1_sweep_polynomial(const T* f, const unsigned order, const T& t0, const T& t1, T& p0, T& p1)
+  {
+    p0 = f[order];
+    p1 = f[order];
+
+    for (unsigned n = order; n > 0u; --n)
+    {
+      const T c = f[n - 1u];
+      p0 = (p0 * t0) + c;
+      p1 = (p1 * t1) + c;
+    }
+  }
+
+  // Fills w[0..n) with M(z[i]) for points ordered away from z = 0, all on
+  // one side of it, anchored directly at z[0] unless the expansion about
+  // z = 0, where M = 1 and M' = a / b exactly, reaches that far. The
+  // anchors allow a relative error of tolerance, and every step truncates
+  // its polynomial at a sixteenth of it.
+  template <class T, class InputIterator, class OutputIterator, class Policy>
+  inline void hypergeometric_1f1_sweep_run(const T& a, const T& b, InputIterator z, const std::size_t n, OutputIterator w, const unsigned order, const T& tolerance, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // fabs
+
+    if (n == 0)
+      return;
+
+    const T direction = (z[n - 1u] < z[0]) ? T(-1) : T(1);
+    const T truncation = tolerance / 16;
+
+    std::vector<T> f(order + 1u);
+
+    T centre = 0;
+    f[0] = 1;
+    detail::hypergeometric_1f1_sweep_taylor(a, b, centre, &f[0], order);
+    T step = detail::hypergeometric_1f1_sweep_step(&f[0], order, centre, truncation);
+
+    if (fabs(z[0]) > step)
+    {
+      T second;
+      centre = z[0];
+      f[0] = detail::hypergeometric_1f1_derivatives_imp(a, b, centre, f[1], second, pol);
+      detail::hypergeometric_1f1_sweep_taylor(a, b, centre, &f[0], order);
+      step = detail::hypergeometric_1f1_sweep_step(&f[0], order, centre, truncation);
+    }
+
+    // the interval between anchors starts at one step, doubles after every
+    // anchor that agrees with the propagated value and halves after every one
+    // that does not, so the walk anchors often where errors grow quickly
+    const unsigned anchor_interval = detail::hypergeometric_1f1_sweep_anchor_interval();
+    unsigned interval = 1u;
+    unsigned steps = 0u;
+    std::size_t segment = 0u; // first point walked since the last anchor
+
+    for (std::size_t i = 0; i < n; )
+    {
+      while (fabs(z[i] - centre) > step)
+      {
+        // the new centre as represented, and the exact distance to it
+        const T next = centre + (direction * step);
+        const T h = next - centre;
+
+        T derivative;
+        T value = detail::hypergeometric_1f1_sweep_polynomial(&f[0], order, h, derivative);
+        centre = next;
+
+        if (++steps == interval)
+        {
+          T direct_derivative, second;
+          const T direct = detail::hypergeometric_1f1_derivatives_imp(a, b, centre, direct_derivative, second, pol);
+
+          if (fabs(value - direct) <= fabs(tolerance * direct))
+            interval = (std::min)(2u * interval, anchor_interval);
+          else
+          {
+            for (std::size_t k = segment; k < i; ++k)
+              w[k] = detail::hypergeometric_1f1_imp(a, b, T(z[k]), pol);
+            interval = (std::max)(interval / 2u, 1u);
+          }
+
+          value = direct;
+          derivative = direct_derivative;
+          segment = i;
+          steps = 0u;
+        }
+
+        f[0] = value;
+        f[1] = derivative;
+        detail::hypergeometric_1f1_sweep_taylor(a, b, centre, &f[0], order);
+        step = detail::hypergeometric_1f1_sweep_step(&f[0], order, centre, truncation);
+      }
+
+      // the points within the step, two at a time
+      if ((i + 1u < n) && !(fabs(z[i + 1u] - centre) > step))
+      {
+        T p0, p1;
+        detail::hypergeometric_1f1_sweep_polynomial(&f[0], order, T(z[i] - centre), T(z[i + 1u] - centre), p0, p1);
+        w[i] = p0;
+        w[i + 1u] = p1;
+        i += 2u;
+      }
+      else
+      {
+        w[i] = detail::hypergeometric_1f1_sweep_polynomial(&f[0], order, T(z[i] - centre));
+        ++i;
+      }
+    }
+
+    // the points past the last anchor are checked at the last of them
+    if (segment + 1u < n)
+    {
+      const T direct = detail::hypergeometric_1f1_imp(a, b, T(z[n - 1u]), pol);
+      if (!(fabs(w[n - 1u] - direct) <= fabs(tolerance * direct)))
+        for (std::size_t k = segment; k + 1u < n; ++k)
+          w[k] = detail::hypergeometric_1f1_imp(a, b, T(z[k]), pol);
+      w[n - 1u] = direct;
+    }
+  }
+
+  // Walks the positions [first, last) of the walk order over the points x,
+  // sorted by increasing z: from x[negative] up, then from x[negative - 1]
+  // down, where negative is the number of points with z < 0. A chunk starts
+  // a run of its own. x[k] is the point result[position[k]], or result[k]
+  // when position is empty.
+  template <class T, class ResultType, class RandomAccessIterator, class Policy>
+  struct hypergeometric_1f1_sweep_task
+  {
+    hypergeometric_1f1_sweep_task(const T& a, const T& b, const std::vector<T>& x, const std::vector<std::size_t>& position, std::size_t negative,
+                                  std::vector<T>& w, RandomAccessIterator result, const Policy& pol):
+      a(a), b(b), x(x), position(position), negative(negative), w(w), result(result), pol(pol)
+    {
+    }
+
+    void operator()(std::size_t first, std::size_t last)
+    {
+      const std::size_t split = x.size() - negative;
+
+      if (first < split)
+      {
+        const std::size_t begin = negative + first;
+        const std::size_t end = negative + (std::min)(last, split);
+        run(&x[0] + begin, end - begin, &w[0] + begin);
+        store(begin, end);
+      }
+
+      if (last > split)
+      {
+        const std::size_t begin = negative - (last - split);
+        const std::size_t end = negative - ((std::max)(first, split) - split);
+        run(std::reverse_iterator<const T*>(&x[0] + end), end - begin, std::reverse_iterator<T*>(&w[0] + end));
+        store(begin, end);
+      }
+    }
+
+  private:
+    template <class InputIterator, class OutputIterator>
+    void run(InputIterator z, std::size_t n, OutputIterator values)
+    {
+      // eight epsilon of ResultType at the anchors
+      detail::hypergeometric_1f1_sweep_run(a, b, z, n, values,
+        detail::hypergeometric_1f1_sweep_order<ResultType>(),
+        T(8 * boost::math::tools::epsilon<ResultType>()),
+        pol);
+    }
+
+    void store(std::size_t begin, std::size_t end)
+    {
+      for (std::size_t k = begin; k < end; ++k)
+        result[position.empty() ? k : position[k]] = policies::checked_narrowing_cast<ResultType, Policy>(
+          w[k],
+          "boost::math::hypergeometric_1f1_sweep<%1%>(%1%,%1%,%1%)");
+    }
+
+    const T a, b;
+    const std::vector<T>& x;
+    const std::vector<std::size_t>& position;
+    const std::size_t negative;
+    std::vector<T>& w;
+    RandomAccessIterator result;
+    const Policy& pol;
+  };
+
+  template <class T, class ResultType, class RandomAccessIterator, class Policy>
+  inline void hypergeometric_1f1_sweep_imp(const T& a, const T& b, const std::vector<T>& z, RandomAccessIterator result, unsigned threads, const Policy& pol)
+  {
+    static const char* const function = "boost::math::hypergeometric_1f1_sweep<%1%>(%1%,%1%,%1%)";
+
+    if (z.empty())
+      return;
+
+    if (!detail::check_hypergeometric_1f1_parameters(a, b))
+    {
+      policies::raise_domain_error<ResultType>(
+        function,
+        "Function is indeterminate for negative integer b = %1%.",
+        static_cast<ResultType>(b),
+        pol);
+      return;
+    }
+
+    // a scan is usually sorted and finite already, and is walked in place
+    bool sorted = true;
+    for (std::size_t i = 0; sorted && (i < z.size()); ++i)
+      sorted = (boost::math::isfinite)(z[i]) && ((i == 0) || !(z[i] < z[i - 1u]));
+
+    // otherwise the points are sorted with their positions, and those that
+    // are not finite are evaluated on their own
+    std::vector<T> sorted_z;
+    std::vector<std::size_t> position;
+    if (!sorted)
+    {
+      std::vector<std::pair<T, std::size_t> > points;
+      points.reserve(z.size());
+      for (std::size_t i = 0; i < z.size(); ++i)
+      {
+        if ((boost::math::isfinite)(z[i]))
+          points.push_back(std::make_pair(z[i], i));
+        else
+          result[i] = policies::checked_narrowing_cast<ResultType, Policy>(detail::hypergeometric_1f1_imp(a, b, z[i], pol), function);
+      }
+
+      std::sort(points.begin(), points.end());
+
+      sorted_z.reserve(points.size());
+      position.reserve(points.size());
+      for (std::size_t k = 0; k < points.size(); ++k)
+      {
+        sorted_z.push_back(points[k].first);
+        position.push_back(points[k].second);
+      }
+    }
+
+    const std::vector<T>& x = sorted ? z : sorted_z;
+    if (x.empty())
+      return;
+
+    const std::size_t negative = std::lower_bound(x.begin(), x.end(), T(0)) - x.begin();
+    std::vector<T> w(x.size());
+
+    // the chunks of the thread split start runs of their own
+    detail::hypergeometric_1f1_sweep_task<T, ResultType, RandomAccessIterator, Policy> task(a, b, x, position, negative, w, result, pol);
+    tools::parallel_for_chunks(x.size(), threads, task);
+  }
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_HYPERGEOMETRIC_1F1_SWEEP_HPP
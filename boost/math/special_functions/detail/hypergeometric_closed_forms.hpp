@@ -0,0 +1,331 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2014 Anton Bikineev
+//  Copyright 2014 Christopher Kormanyos
+//  Copyright 2014 John Maddock
+//  Copyright 2014 Paul Bristow
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_MATH_HYPERGEOMETRIC_CLOSED_FORMS_HPP
+  #define BOOST_MATH_HYPERGEOMETRIC_CLOSED_FORMS_HPP
+
+  #include <limits>
+
+  #include <boost/math/tools/precision.hpp>
+  #include <boost/math/special_functions/gamma.hpp>
+  #include <boost/math/special_functions/erf.hpp>
+  #include <boost/math/special_functions/bessel.hpp>
+  #include <boost/math/special_functions/legendre.hpp>
+  #include <boost/math/special_functions/log1p.hpp>
+  #include <boost/math/special_functions/atanh.hpp>
+  #include <boost/math/special_functions/asinh.hpp>
+  #include <boost/math/special_functions/factorials.hpp>
+  #include <boost/math/constants/constants.hpp>
+
+  // Parameter families of 0F1, 1F1 and 2F1 with closed forms in terms of
+  // elementary functions or of the incomplete gamma, error, Bessel and
+  // Legendre functions. Each family is an entry of a table holding a
+  // matcher, which also checks that the closed form neither overflows nor
+  // leaves its real domain, and an evaluator. 1F1 is matched both as given
+  // and after Kummer's transformation M(a, b, z) = e^z M(b - a, b, -z),
+  // 2F1 in both orders of its upper parameters.
+
+  namespace boost { namespace math { namespace detail {
+
+  template <class T, class Policy>
+  struct hypergeometric_0f1_closed_form
+  {
+    bool (*matches)(const T& b, const T& z);
+    T (*evaluate)(const T& b, const T& z, const Policy& pol);
+  };
+
+  template <class T, class Policy>
+  struct hypergeometric_1f1_closed_form
+  {
+    bool (*matches)(const T& a, const T& b, const T& z);
+    T (*evaluate)(const T& a, const T& b, const T& z, const Policy& pol);
+  };
+
+  template <class T, class Policy>
+  struct hypergeometric_2f1_closed_form
+  {
+    bool (*matches)(const T& a1, const T& a2, const T& b, const T& z);
+    T (*evaluate)(const T& a1, const T& a2, const T& b, const T& z, const Policy& pol);
+  };
+
+  // cosh(2 sqrt(z)) and sinh(2 sqrt(z)) are finite
+  template <class T>
+  inline bool hypergeometric_0f1_hyperbolic_range(const T& z)
+  {
+    return z < (tools::log_max_value<T>() * tools::log_max_value<T>()) / 4;
+  }
+
+  // 0F1(; 1/2; z) = cosh(2 sqrt(z)), cos(2 sqrt(-z)) for negative z
+  template <class T>
+  inline bool hypergeometric_0f1_cosh_matches(const T& b, const T& z)
+  {
+    return (b == 0.5f) && detail::hypergeometric_0f1_hyperbolic_range(z);
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_0f1_cosh(const T& /* b */, const T& z, const Policy& /* pol */)
+  {
+    BOOST_MATH_STD_USING // sqrt, cosh, cos
+
+    return (z > 0) ? T(cosh(2 * sqrt(z))) : T(cos(2 * sqrt(-z)));
+  }
+
+  // 0F1(; 3/2; z) = sinh(2 sqrt(z)) / (2 sqrt(z)),
+  // sin(2 sqrt(-z)) / (2 sqrt(-z)) for negative z
+  template <class T>
+  inline bool hypergeometric_0f1_sinh_matches(const T& b, const T& z)
+  {
+    return (b == 1.5f) && (z != 0) && detail::hypergeometric_0f1_hyperbolic_range(z);
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_0f1_sinh(const T& /* b */, const T& z, const Policy& /* pol */)
+  {
+    BOOST_MATH_STD_USING // sqrt, sinh, sin
+
+    const T two_sqrt_z = 2 * ((z > 0) ? T(sqrt(z)) : T(sqrt(-z)));
+
+    return ((z > 0) ? T(sinh(two_sqrt_z)) : T(sin(two_sqrt_z))) / two_sqrt_z;
+  }
+
+  // 1F1(1/2; 3/2; -x^2) = sqrt(pi) / (2 x) erf(x)
+  template <class T>
+  inline bool hypergeometric_1f1_erf_matches(const T& a, const T& b, const T& z)
+  {
+    return (a == 0.5f) && (b == 1.5f) && (z < 0);
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_erf(const T& /* a */, const T& /* b */, const T& z, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // sqrt
+
+    const T x = sqrt(-z);
+
+    return (boost::math::constants::root_pi<T>() * boost::math::erf(x, pol)) / (2 * x);
+  }
+
+  // 1F1(a; a + 1; -x) = a x^-a gamma(a, x), the lower incomplete gamma function
+  template <class T>
+  inline bool hypergeometric_1f1_tgamma_lower_matches(const T& a, const T& b, const T& z)
+  {
+    BOOST_MATH_STD_USING // fabs, log
+
+    return (b == a + 1) && (a > 0) && (z < 0) &&
+      (a < boost::math::max_factorial<T>::value) &&
+      (fabs(a * log(-z)) < tools::log_max_value<T>());
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_tgamma_lower(const T& a, const T& /* b */, const T& z, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // pow
+
+    return (a * boost::math::tgamma_lower(a, -z, pol)) / pow(-z, a);
+  }
+
+  // 1F1(a; 2a; z) = Gamma(a + 1/2) e^(z/2) (z/4)^(1/2 - a) I(a - 1/2, z/2)
+  template <class T>
+  inline bool hypergeometric_1f1_bessel_i_matches(const T& a, const T& b, const T& z)
+  {
+    BOOST_MATH_STD_USING // fabs, log
+
+    return (b == 2 * a) && (a > 0) && (z > 0) &&
+      (a < boost::math::max_factorial<T>::value) &&
+      (z < tools::log_max_value<T>()) &&
+      (fabs((a - 0.5f) * log(z / 4)) < tools::log_max_value<T>());
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_bessel_i(const T& a, const T& /* b */, const T& z, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // exp, pow
+
+    const T v = a - 0.5f;
+    const T half_z = z / 2;
+
+    return ((boost::math::tgamma(a + 0.5f, pol) * exp(half_z)) / pow(half_z / 2, v)) *
+      boost::math::cyl_bessel_i(v, half_z, pol);
+  }
+
+  // 2F1(a1, b; b; z) = (1 - z)^-a1
+  template <class T>
+  inline bool hypergeometric_2f1_power_matches(const T& /* a1 */, const T& a2, const T& b, const T& z)
+  {
+    return (a2 == b) && (z < 1);
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_2f1_power(const T& a1, const T& /* a2 */, const T& /* b */, const T& z, const Policy& /* pol */)
+  {
+    BOOST_MATH_STD_USING // pow
+
+    return pow(1 - z, -a1);
+  }
+
+  // 2F1(1, 1; 2; z) = -log(1 - z) / z
+  template <class T>
+  inline bool hypergeometric_2f1_log_matches(const T& a1, const T& a2, const T& b, const T& z)
+  {
+    return (a1 == 1) && (a2 == 1) && (b == 2) && (z != 0) && (z < 1);
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_2f1_log(const T& /* a1 */, const T& /* a2 */, const T& /* b */, const T& z, const Policy& pol)
+  {
+    return -boost::math::log1p(-z, pol) / z;
+  }
+
+  // 2F1(1/2, 1; 3/2; x^2) = atanh(x) / x, 2F1(1/2, 1; 3/2; -x^2) = atan(x) / x
+  template <class T>
+  inline bool hypergeometric_2f1_atanh_matches(const T& a1, const T& a2, const T& b, const T& z)
+  {
+    return (a1 == 0.5f) && (a2 == 1) && (b == 1.5f) && (z != 0) && (z < 1);
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_2f1_atanh(const T& /* a1 */, const T& /* a2 */, const T& /* b */, const T& z, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // sqrt, atan
+
+    const T x = (z > 0) ? T(sqrt(z)) : T(sqrt(-z));
+
+    return ((z > 0) ? T(boost::math::atanh(x, pol)) : T(atan(x))) / x;
+  }
+
+  // 2F1(1/2, 1/2; 3/2; x^2) = asin(x) / x, 2F1(1/2, 1/2; 3/2; -x^2) = asinh(x) / x
+  template <class T>
+  inline bool hypergeometric_2f1_asin_matches(const T& a1, const T& a2, const T& b, const T& z)
+  {
+    return (a1 == 0.5f) && (a2 == 0.5f) && (b == 1.5f) && (z != 0) && (z <= 1);
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_2f1_asin(const T& /* a1 */, const T& /* a2 */, const T& /* b */, const T& z, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // sqrt, asin
+
+    const T x = (z > 0) ? T(sqrt(z)) : T(sqrt(-z));
+
+    return ((z > 0) ? T(asin(x)) : T(boost::math::asinh(x, pol))) / x;
+  }
+
+  // 2F1(-n, n + 1; 1; (1 - x) / 2) = P(n, x), the Legendre polynomial
+  template <class T>
+  inline bool hypergeometric_2f1_legendre_matches(const T& a1, const T& a2, const T& b, const T& z)
+  {
+    BOOST_MATH_STD_USING // floor
+
+    return (b == 1) && (a1 <= 0) && (a1 == floor(a1)) && (a2 == 1 - a1) &&
+      (a1 > -static_cast<T>((std::numeric_limits<int>::max)())) && (z >= 0) && (z <= 1);
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_2f1_legendre(const T& a1, const T& /* a2 */, const T& /* b */, const T& z, const Policy& pol)
+  {
+    const int n = boost::math::itrunc(-a1, pol);
+
+    return boost::math::legendre_p(n, 1 - (2 * z), pol);
+  }
+
+  template <class T, class Policy>
+  inline bool hypergeometric_0f1_closed_form_imp(const T& b, const T& z, T& result, const Policy& pol)
+  {
+    static const hypergeometric_0f1_closed_form<T, Policy> forms[] =
+    {
+      { &detail::hypergeometric_0f1_cosh_matches<T>, &detail::hypergeometric_0f1_cosh<T, Policy> },
+      { &detail::hypergeometric_0f1_sinh_matches<T>, &detail::hypergeometric_0f1_sinh<T, Policy> }
+    };
+
+    for (unsigned i = 0; i < sizeof(forms) / sizeof(forms[0]); ++i)
+    {
+      if (forms[i].matches(b, z))
+      {
+        result = forms[i].evaluate(b, z, pol);
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  template <class T, class Policy>
+  inline bool hypergeometric_1f1_closed_form_imp(const T& a, const T& b, const T& z, T& result, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // exp, fabs
+
+    static const hypergeometric_1f1_closed_form<T, Policy> forms[] =
+    {
+      { &detail::hypergeometric_1f1_erf_matches<T>, &detail::hypergeometric_1f1_erf<T, Policy> },
+      { &detail::hypergeometric_1f1_tgamma_lower_matches<T>, &detail::hypergeometric_1f1_tgamma_lower<T, Policy> },
+      { &detail::hypergeometric_1f1_bessel_i_matches<T>, &detail::hypergeometric_1f1_bessel_i<T, Policy> }
+    };
+
+    const unsigned count = sizeof(forms) / sizeof(forms[0]);
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+      if (forms[i].matches(a, b, z))
+      {
+        result = forms[i].evaluate(a, b, z, pol);
+        return true;
+      }
+    }
+
+    if (fabs(z) >= tools::log_max_value<T>())
+      return false;
+
+    const T b_minus_a = b - a;
+
+    for (unsigned i = 0; i < count; ++i)
+    {
+      if (forms[i].matches(b_minus_a, b, -z))
+      {
+        result = exp(z) * forms[i].evaluate(b_minus_a, b, -z, pol);
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  template <class T, class Policy>
+  inline bool hypergeometric_2f1_closed_form_imp(const T& a1, const T& a2, const T& b, const T& z, T& result, const Policy& pol)
+  {
+    static const hypergeometric_2f1_closed_form<T, Policy> forms[] =
+    {
+      { &detail::hypergeometric_2f1_power_matches<T>, &detail::hypergeometric_2f1_power<T, Policy> },
+      { &detail::hypergeometric_2f1_log_matches<T>, &detail::hypergeometric_2f1_log<T, Policy> },
+      { &detail::hypergeometric_2f1_atanh_matches<T>, &detail::hypergeometric_2f1_atanh<T, Policy> },
+      { &detail::hypergeometric_2f1_asin_matches<T>, &detail::hypergeometric_2f1_asin<T, Policy> },
+      { &detail::hypergeometric_2f1_legendre_matches<T>, &detail::hypergeometric_2f1_legendre<T, Policy> }
+    };
+
+    for (unsigned i = 0; i < sizeof(forms) / sizeof(forms[0]); ++i)
+    {
+      // 2F1 is symmetric in a1 and a2
+      if (forms[i].matches(a1, a2, b, z))
+      {
+        result = forms[i].evaluate(a1, a2, b, z, pol);
+        return true;
+      }
+      if (forms[i].matches(a2, a1, b, z))
+      {
+        result = forms[i].evaluate(a2, a1, b, z, pol);
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_HYPERGEOMETRIC_CLOSED_FORMS_HPP
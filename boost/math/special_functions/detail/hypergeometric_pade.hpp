@@ -11,41 +11,49 @@
 #ifndef BOOST_MATH_HYPERGEOMETRIC_PADE_HPP
   #define BOOST_MATH_HYPERGEOMETRIC_PADE_HPP
 
+  #include <utility>
+
+  #include <boost/math/tools/double_double.hpp>
+  #include <boost/math/tools/inplace_arithmetic.hpp>
+
   namespace boost{ namespace math{ namespace detail{
 
   // Luke: C ---------- SUBROUTINE R1F1P(CP, Z, A, B, N) ----------
   // Luke: C ----- PADE APPROXIMATION OF 1F1( 1 ; CP ; -Z ) -------
-  template <class T, class Policy>
-  inline T hypergeometric_1f1_pade(const T& cp, const T& zp, const Policy& pol)
+  //
+  // The recurrences are carried in Real (T or double-double), the
+  // counter stays in T where it is exact.
+  template <class Real, class T, class Policy>
+  inline Real hypergeometric_1f1_pade_imp(const Real& cp, const Real& zp, const T& tolerance, const Policy& pol, boost::mpl::false_)
   {
     BOOST_MATH_STD_USING
 
     static const T one = T(1);
 
     // Luke: C ------------- INITIALIZATION -------------
-    const T z = -zp;
-    const T zz = z * z;
-    T b0 = one;
-    T a0 = one;
+    const Real z = -zp;
+    const Real zz = z * z;
+    Real b0 = one;
+    Real a0 = one;
     T xi1 = one;
-    T ct1 = cp + one;
-    T cp1 = cp - one;
+    Real ct1 = cp + one;
+    Real cp1 = cp - one;
 
-    T b1 = one + (z / ct1);
-    T a1 = b1 - (z / cp);
+    Real b1 = one + (z / ct1);
+    Real a1 = b1 - (z / cp);
 
     const unsigned max_iterations = boost::math::policies::get_max_series_iterations<Policy>();
 
-    T b2 = T(0), a2 = T(0);
-    T result = T(0), prev_result = a1 / b1;
+    Real b2 = T(0), a2 = T(0);
+    Real result = T(0), prev_result = a1 / b1;
 
     for (unsigned k = 1; k < max_iterations; ++k)
     {
       // Luke: C ----- CALCULATION OF THE MULTIPLIERS -----
       // Luke: C ----------- FOR THE RECURSION ------------
-      const T ct2 = ct1 * ct1;
-      const T g1 = one + ((cp1 / (ct2 + ct1 + ct1)) * z);
-      const T g2 = ((xi1 / (ct2 - one)) * ((xi1 + cp1) / ct2)) * zz;
+      const Real ct2 = ct1 * ct1;
+      const Real g1 = one + ((cp1 / (ct2 + ct1 + ct1)) * z);
+      const Real g2 = ((xi1 / (ct2 - one)) * ((xi1 + cp1) / ct2)) * zz;
 
       // Luke: C ------- THE RECURRENCE RELATIONS ---------
       // Luke: C ------------ ARE AS FOLLOWS --------------
@@ -56,19 +64,101 @@
       result = a2 / b2;
 
       // condition for interruption
-      if ((fabs(result) * boost::math::tools::epsilon<T>()) > fabs(result - prev_result))
+      if ((fabs(result) * tolerance) > fabs(result - prev_result))
         break;
 
       b0 = b1; b1 = b2;
       a0 = a1; a1 = a2;
 
-      ct1 += 2;
+      ct1 += T(2);
       ++xi1;
     }
 
     return a2 / b2;
   }
 
+  // the same recurrence for tools::inplace_arithmetic types, every
+  // step in place on variables that live as long as the loop
+  template <class Real, class T, class Policy>
+  inline Real hypergeometric_1f1_pade_imp(const Real& cp, const Real& zp, const T& tolerance, const Policy& pol, boost::mpl::true_)
+  {
+    using std::swap;
+
+    static const T zero = T(0), one = T(1), two = T(2);
+
+    // Luke: C ------------- INITIALIZATION -------------
+    const Real z = -zp;
+    const Real zz = z * z;
+    Real b0 = one;
+    Real a0 = one;
+    T xi1 = one;
+    Real ct1 = cp + one;
+    Real cp1 = cp - one;
+
+    Real b1 = one + (z / ct1);
+    Real a1 = b1 - (z / cp);
+
+    const unsigned max_iterations = boost::math::policies::get_max_series_iterations<Policy>();
+
+    const Real real_zero = zero;
+    Real b2 = zero, a2 = zero;
+    Real result = zero, prev_result = zero;
+    Real ct2 = zero, g1 = zero, g2 = zero, t = zero, difference = zero;
+
+    for (unsigned k = 1; k < max_iterations; ++k)
+    {
+      // Luke: C ----- CALCULATION OF THE MULTIPLIERS -----
+      // Luke: C ----------- FOR THE RECURSION ------------
+      ct2 = ct1; ct2 *= ct1;
+      // g1 = one + ((cp1 / (ct2 + ct1 + ct1)) * z)
+      t = ct2; t += ct1; t += ct1;
+      g1 = cp1; g1 /= t; g1 *= z; g1 += one;
+      // g2 = ((xi1 / (ct2 - one)) * ((xi1 + cp1) / ct2)) * zz
+      t = ct2; t -= one;
+      g2 = xi1; g2 /= t;
+      t = cp1; t += xi1; t /= ct2;
+      g2 *= t; g2 *= zz;
+
+      // Luke: C ------- THE RECURRENCE RELATIONS ---------
+      // Luke: C ------------ ARE AS FOLLOWS --------------
+      b2 = g1; b2 *= b1; t = g2; t *= b0; b2 += t;
+      a2 = g1; a2 *= a1; t = g2; t *= a0; a2 += t;
+
+      swap(prev_result, result);
+      result = a2; result /= b2;
+
+      // condition for interruption
+      difference = result; difference -= prev_result;
+      tools::inplace_fabs(difference, real_zero);
+      t = result; tools::inplace_fabs(t, real_zero); t *= tolerance;
+      if (t > difference)
+        break;
+
+      swap(b0, b1); swap(b1, b2);
+      swap(a0, a1); swap(a1, a2);
+
+      ct1 += two;
+      ++xi1;
+    }
+
+    return result;
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_pade(const T& cp, const T& zp, const Policy& pol)
+  {
+    typedef tools::accumulation_traits<T, Policy> accumulation_traits;
+    typedef typename accumulation_traits::type accumulation_type;
+
+    return accumulation_traits::value(
+      detail::hypergeometric_1f1_pade_imp(
+        accumulation_type(cp),
+        accumulation_type(zp),
+        accumulation_traits::tolerance(boost::math::tools::epsilon<T>()),
+        pol,
+        typename tools::inplace_arithmetic<accumulation_type>::type()));
+  }
+
   // Luke: C -------- SUBROUTINE R2F1P(BP, CP, Z, A, B, N) --------
   // Luke: C ---- PADE APPROXIMATION OF 2F1( 1 , BP; CP ; -Z ) ----
   template <class T, class Policy>
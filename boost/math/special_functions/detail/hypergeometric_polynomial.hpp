@@ -0,0 +1,170 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2014 Anton Bikineev
+//  Copyright 2014 Christopher Kormanyos
+//  Copyright 2014 John Maddock
+//  Copyright 2014 Paul Bristow
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef BOOST_MATH_HYPERGEOMETRIC_POLYNOMIAL_HPP
+  #define BOOST_MATH_HYPERGEOMETRIC_POLYNOMIAL_HPP
+
+  #include <algorithm>
+  #include <limits>
+
+  #include <boost/math/policies/error_handling.hpp>
+  #include <boost/math/tools/scaled_polynomial.hpp>
+  #include <boost/math/special_functions/trunc.hpp>
+
+  // The series of 1F1(a; b; z) and 2F1(a1, a2; b; z) terminate when an upper
+  // parameter is a non-positive integer -n: they are polynomials of degree
+  // n in z (Laguerre and Jacobi polynomials up to normalization). Their
+  // coefficients are formed once, scaled, and the polynomial is then
+  // evaluated at any number of points for n multiplications each.
+
+  namespace boost { namespace math { namespace detail {
+
+  // forward declaration of the parameter check
+  template <class T>
+  inline bool check_hypergeometric_1f1_parameters(const T& a, const T& b);
+
+  // degree receives n when a = -n, a non-positive integer
+  template <class T>
+  inline bool hypergeometric_is_terminating(const T& a, unsigned& degree)
+  {
+    BOOST_MATH_STD_USING // floor
+
+    if ((a > 0) || (a != floor(a)))
+      return false;
+
+    // past any series limit anyway
+    if (-a > (std::numeric_limits<unsigned>::max)())
+      degree = (std::numeric_limits<unsigned>::max)();
+    else
+      degree = static_cast<unsigned>(boost::math::lltrunc(-a));
+
+    return true;
+  }
+
+  // c(k + 1) / c(k) of 1F1(a; b; z)
+  template <class T>
+  struct hypergeometric_1f1_term_ratio
+  {
+    hypergeometric_1f1_term_ratio(const T& a, const T& b): a(a), b(b)
+    {
+    }
+
+    T operator()(unsigned k) const
+    {
+      return (a + k) / ((b + k) * (k + 1));
+    }
+
+  private:
+    const T a, b;
+  };
+
+  // c(k + 1) / c(k) of 2F1(a1, a2; b; z)
+  template <class T>
+  struct hypergeometric_2f1_term_ratio
+  {
+    hypergeometric_2f1_term_ratio(const T& a1, const T& a2, const T& b): a1(a1), a2(a2), b(b)
+    {
+    }
+
+    T operator()(unsigned k) const
+    {
+      return ((a1 + k) * (a2 + k)) / ((b + k) * (k + 1));
+    }
+
+  private:
+    const T a1, a2, b;
+  };
+
+  // a degree beyond the series limit of the policy is refused, the
+  // coefficients would take as long to form as that many series terms
+  template <class ResultType, class T, class Ratio, class Policy>
+  inline tools::scaled_polynomial<ResultType> hypergeometric_polynomial_imp(const Ratio& ratio, const unsigned degree, const char* function, const Policy& pol)
+  {
+    if (degree > policies::get_max_series_iterations<Policy>())
+    {
+      policies::raise_evaluation_error<ResultType>(
+        function,
+        "The polynomial has degree %1%, more than the series iteration limit.",
+        static_cast<ResultType>(degree),
+        pol);
+      return tools::scaled_polynomial<ResultType>();
+    }
+
+    return tools::make_scaled_polynomial<ResultType, T>(ratio, degree);
+  }
+
+  template <class ResultType, class T, class Policy>
+  inline tools::scaled_polynomial<ResultType> hypergeometric_1f1_polynomial_imp(const T& a, const T& b, const Policy& pol)
+  {
+    static const char* const function = "boost::math::hypergeometric_1f1_polynomial<%1%>(%1%,%1%)";
+
+    unsigned degree = 0u;
+    if (!detail::hypergeometric_is_terminating(a, degree))
+    {
+      policies::raise_domain_error<ResultType>(
+        function,
+        "The series terminates only for non-positive integer a, got a = %1%.",
+        static_cast<ResultType>(a),
+        pol);
+      return tools::scaled_polynomial<ResultType>();
+    }
+
+    if (!detail::check_hypergeometric_1f1_parameters(a, b))
+    {
+      policies::raise_domain_error<ResultType>(
+        function,
+        "Function is indeterminate for negative integer b = %1%.",
+        static_cast<ResultType>(b),
+        pol);
+      return tools::scaled_polynomial<ResultType>();
+    }
+
+    return detail::hypergeometric_polynomial_imp<ResultType, T>(detail::hypergeometric_1f1_term_ratio<T>(a, b), degree, function, pol);
+  }
+
+  template <class ResultType, class T, class Policy>
+  inline tools::scaled_polynomial<ResultType> hypergeometric_2f1_polynomial_imp(const T& a1, const T& a2, const T& b, const Policy& pol)
+  {
+    static const char* const function = "boost::math::hypergeometric_2f1_polynomial<%1%>(%1%,%1%,%1%)";
+
+    // the series stops at the first of the upper parameters to vanish
+    unsigned degree1 = 0u, degree2 = 0u;
+    const bool terminates1 = detail::hypergeometric_is_terminating(a1, degree1);
+    const bool terminates2 = detail::hypergeometric_is_terminating(a2, degree2);
+
+    if (!terminates1 && !terminates2)
+    {
+      policies::raise_domain_error<ResultType>(
+        function,
+        "The series terminates only for a non-positive integer upper parameter, got a1 = %1%.",
+        static_cast<ResultType>(a1),
+        pol);
+      return tools::scaled_polynomial<ResultType>();
+    }
+
+    if (!detail::check_hypergeometric_1f1_parameters(a1, b) ||
+        !detail::check_hypergeometric_1f1_parameters(a2, b))
+    {
+      policies::raise_domain_error<ResultType>(
+        function,
+        "Function is indeterminate for negative integer b = %1%.",
+        static_cast<ResultType>(b),
+        pol);
+      return tools::scaled_polynomial<ResultType>();
+    }
+
+    const unsigned degree = (terminates1 && terminates2) ? (std::min)(degree1, degree2) : (terminates1 ? degree1 : degree2);
+
+    return detail::hypergeometric_polynomial_imp<ResultType, T>(detail::hypergeometric_2f1_term_ratio<T>(a1, a2, b), degree, function, pol);
+  }
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_HYPERGEOMETRIC_POLYNOMIAL_HPP
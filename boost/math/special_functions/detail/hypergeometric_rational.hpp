@@ -11,52 +11,59 @@
 #ifndef BOOST_MATH_HYPERGEOMETRIC_RATIONAL_HPP
   #define BOOST_MATH_HYPERGEOMETRIC_RATIONAL_HPP
 
+  #include <utility>
+
   #include <boost/array.hpp>
+  #include <boost/math/tools/double_double.hpp>
+  #include <boost/math/tools/inplace_arithmetic.hpp>
 
   namespace boost{ namespace math{ namespace detail{
 
   // Luke: C ------- SUBROUTINE R1F1P(AP, CP, Z, A, B, N) ---------
   // Luke: C --- RATIONAL APPROXIMATION OF 1F1( AP ; CP ; -Z ) ----
-  template <class T, class Policy>
-  inline T hypergeometric_1f1_rational(const T& ap, const T& cp, const T& zp, const Policy& pol)
+  //
+  // The recurrences are carried in Real (T or double-double), the
+  // counters stay in T where they are exact.
+  template <class Real, class T, class Policy>
+  inline Real hypergeometric_1f1_rational_imp(const Real& ap, const Real& cp, const Real& zp, const T& tolerance, const Policy& pol, boost::mpl::false_)
   {
     BOOST_MATH_STD_USING
 
     static const T zero = T(0), one = T(1), two = T(2), three = T(3);
 
     // Luke: C ------------- INITIALIZATION -------------
-    const T z = -zp;
-    const T z2 = z / two;
+    const Real z = -zp;
+    const Real z2 = z / two;
 
-    T ct1 = ap * (z / cp);
-    T ct2 = z2 / (one + cp);
+    Real ct1 = ap * (z / cp);
+    Real ct2 = z2 / (one + cp);
     T xn3 = zero;
     T xn2 = one;
     T xn1 = two;
     T xn0 = three;
 
-    T b1 = one;
-    T a1 = one;
-    T b2 = one + ((one + ap) * (z2 / cp));
-    T a2 = b2 - ct1;
-    T b3 = one + ((two + b2) * (((two + ap) / three) * ct2));
-    T a3 = b3 - ((one + ct2) * ct1);
+    Real b1 = one;
+    Real a1 = one;
+    Real b2 = one + ((one + ap) * (z2 / cp));
+    Real a2 = b2 - ct1;
+    Real b3 = one + ((two + b2) * (((two + ap) / three) * ct2));
+    Real a3 = b3 - ((one + ct2) * ct1);
     ct1 = three;
 
     const unsigned max_iterations = boost::math::policies::get_max_series_iterations<Policy>();
 
-    T a4 = T(0), b4 = T(0);
-    T result = T(0), prev_result = a3 / b3;
+    Real a4 = zero, b4 = zero;
+    Real result = zero, prev_result = a3 / b3;
 
     for (unsigned k = 2; k < max_iterations; ++k)
     {
       // Luke: C ----- CALCULATION OF THE MULTIPLIERS -----
       // Luke: C ----------- FOR THE RECURSION ------------
       ct2 = (z2 / ct1) / (cp + xn1);
-      const T g1 = one + (ct2 * (xn2 - ap));
+      const Real g1 = one + (ct2 * (xn2 - ap));
       ct2 *= ((ap + xn1) / (cp + xn2));
-      const T g2 = ct2 * ((cp - xn1) + (((ap + xn0) / (ct1 + two)) * z2));
-      const T g3 = ((ct2 * z2) * (((z2 / ct1) / (ct1 - two)) * ((ap + xn2)) / (cp + xn3))) * (ap - xn2);
+      const Real g2 = ct2 * ((cp - xn1) + (((ap + xn0) / (ct1 + two)) * z2));
+      const Real g3 = ((ct2 * z2) * (((z2 / ct1) / (ct1 - two)) * ((ap + xn2)) / (cp + xn3))) * (ap - xn2);
 
       // Luke: C ------- THE RECURRENCE RELATIONS ---------
       // Luke: C ------------ ARE AS FOLLOWS --------------
@@ -67,7 +74,7 @@
       result = a4 / b4;
 
       // condition for interruption
-      if ((fabs(result) * boost::math::tools::epsilon<T>()) > fabs(result - prev_result))
+      if ((fabs(result) * tolerance) > fabs(result - prev_result))
         break;
 
       b1 = b2; b2 = b3; b3 = b4;
@@ -80,6 +87,104 @@
     return result;
   }
 
+  // the same recurrence for tools::inplace_arithmetic types, every
+  // step in place on variables that live as long as the loop, in the
+  // order of the expressions above so the two round alike
+  template <class Real, class T, class Policy>
+  inline Real hypergeometric_1f1_rational_imp(const Real& ap, const Real& cp, const Real& zp, const T& tolerance, const Policy& pol, boost::mpl::true_)
+  {
+    using std::swap;
+
+    static const T zero = T(0), one = T(1), two = T(2), three = T(3);
+
+    // Luke: C ------------- INITIALIZATION -------------
+    const Real z = -zp;
+    const Real z2 = z / two;
+
+    Real ct1 = ap * (z / cp);
+    Real ct2 = z2 / (one + cp);
+    T xn3 = zero;
+    T xn2 = one;
+    T xn1 = two;
+    T xn0 = three;
+
+    Real b1 = one;
+    Real a1 = one;
+    Real b2 = one + ((one + ap) * (z2 / cp));
+    Real a2 = b2 - ct1;
+    Real b3 = one + ((two + b2) * (((two + ap) / three) * ct2));
+    Real a3 = b3 - ((one + ct2) * ct1);
+    ct1 = three;
+
+    const unsigned max_iterations = boost::math::policies::get_max_series_iterations<Policy>();
+
+    const Real real_zero = zero;
+    Real a4 = zero, b4 = zero;
+    Real result = zero, prev_result = zero;
+    Real g1 = zero, g2 = zero, g3 = zero, zc = zero, t = zero, difference = zero;
+
+    for (unsigned k = 2; k < max_iterations; ++k)
+    {
+      // Luke: C ----- CALCULATION OF THE MULTIPLIERS -----
+      // Luke: C ----------- FOR THE RECURSION ------------
+      // ct2 = (z2 / ct1) / (cp + xn1)
+      zc = z2; zc /= ct1;
+      ct2 = zc; t = cp; t += xn1; ct2 /= t;
+      // g1 = one + (ct2 * (xn2 - ap))
+      g1 = xn2; g1 -= ap; g1 *= ct2; g1 += one;
+      // ct2 *= (ap + xn1) / (cp + xn2), g2 holding the divisor
+      t = ap; t += xn1; g2 = cp; g2 += xn2; t /= g2; ct2 *= t;
+      // g2 = ct2 * ((cp - xn1) + (((ap + xn0) / (ct1 + two)) * z2))
+      g2 = ap; g2 += xn0; t = ct1; t += two; g2 /= t;
+      g2 *= z2; t = cp; t -= xn1; g2 += t; g2 *= ct2;
+      // g3 = ((ct2 * z2) * (((z2 / ct1) / (ct1 - two)) * (ap + xn2) / (cp + xn3))) * (ap - xn2)
+      g3 = zc; t = ct1; t -= two; g3 /= t;
+      t = ap; t += xn2; g3 *= t;
+      t = cp; t += xn3; g3 /= t;
+      t = ct2; t *= z2; g3 *= t;
+      t = ap; t -= xn2; g3 *= t;
+
+      // Luke: C ------- THE RECURRENCE RELATIONS ---------
+      // Luke: C ------------ ARE AS FOLLOWS --------------
+      b4 = g1; b4 *= b3; t = g2; t *= b2; b4 += t; t = g3; t *= b1; b4 += t;
+      a4 = g1; a4 *= a3; t = g2; t *= a2; a4 += t; t = g3; t *= a1; a4 += t;
+
+      swap(prev_result, result);
+      result = a4; result /= b4;
+
+      // condition for interruption
+      difference = result; difference -= prev_result;
+      tools::inplace_fabs(difference, real_zero);
+      t = result; tools::inplace_fabs(t, real_zero); t *= tolerance;
+      if (t > difference)
+        break;
+
+      swap(b1, b2); swap(b2, b3); swap(b3, b4);
+      swap(a1, a2); swap(a2, a3); swap(a3, a4);
+
+      xn3 = xn2; xn2 = xn1; xn1 = xn0; ++xn0;
+      ct1 += two;
+    }
+
+    return result;
+  }
+
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_rational(const T& ap, const T& cp, const T& zp, const Policy& pol)
+  {
+    typedef tools::accumulation_traits<T, Policy> accumulation_traits;
+    typedef typename accumulation_traits::type accumulation_type;
+
+    return accumulation_traits::value(
+      detail::hypergeometric_1f1_rational_imp(
+        accumulation_type(ap),
+        accumulation_type(cp),
+        accumulation_type(zp),
+        accumulation_traits::tolerance(boost::math::tools::epsilon<T>()),
+        pol,
+        typename tools::inplace_arithmetic<accumulation_type>::type()));
+  }
+
   // Luke: C ----- SUBROUTINE R2F1P(AB, BP, CP, Z, A, B, N) -------
   // Luke: C -- RATIONAL APPROXIMATION OF 2F1( AB , BP; CP ; -Z ) -
   template <class T, class Policy>
@@ -12,10 +12,18 @@
   #define BOOST_MATH_HYPERGEOMETRIC_SERIES_HPP
 
   #include <boost/math/special_functions/bessel.hpp>
+  #include <boost/math/tools/double_double.hpp>
+  #include <boost/math/tools/inplace_arithmetic.hpp>
 
   namespace boost { namespace math { namespace detail {
 
   // primary template for term of Taylor series
+  //
+  // operator() returns the current term and moves on to the next one;
+  // current() and next() do the same without the copy. The step is an
+  // expression for the built-in types and, with tools::inplace_arithmetic,
+  // a sequence of in-place operations on the scratch variables t1 and t2
+  // taken in the order of the expression, which rounds alike.
   template <class T, unsigned p, unsigned q>
   struct hypergeometric_pfq_generic_series_term;
 
@@ -32,17 +40,39 @@
 
     T operator()()
     {
-      BOOST_MATH_STD_USING
       const T r = term;
-      term *= ((1 / ((b + n) * (n + 1))) * z);
-      ++n;
+      next();
       return r;
     }
 
+    const T& current() const
+    {
+      return term;
+    }
+
+    void next()
+    {
+      advance(typename tools::inplace_arithmetic<T>::type());
+      ++n;
+    }
+
   private:
+    void advance(boost::mpl::false_)
+    {
+      term *= ((1 / ((b + n) * (n + 1))) * z);
+    }
+
+    void advance(boost::mpl::true_)
+    {
+      t1 = b; t1 += n; t1 *= n + 1;
+      t2 = 1; t2 /= t1; t2 *= z;
+      term *= t2;
+    }
+
     unsigned n;
     T term;
     const T b, z;
+    T t1, t2;
   };
 
   // partial specialization for 1F0
@@ -58,17 +88,38 @@
 
     T operator()()
     {
-      BOOST_MATH_STD_USING
       const T r = term;
-      term *= (((a + n) / (n + 1)) * z);
-      ++n;
+      next();
       return r;
     }
 
+    const T& current() const
+    {
+      return term;
+    }
+
+    void next()
+    {
+      advance(typename tools::inplace_arithmetic<T>::type());
+      ++n;
+    }
+
   private:
+    void advance(boost::mpl::false_)
+    {
+      term *= (((a + n) / (n + 1)) * z);
+    }
+
+    void advance(boost::mpl::true_)
+    {
+      t1 = a; t1 += n; t1 /= n + 1; t1 *= z;
+      term *= t1;
+    }
+
     unsigned n;
     T term;
     const T a, z;
+    T t1;
   };
 
   // partial specialization for 1F1
@@ -84,17 +135,40 @@
 
     T operator()()
     {
-      BOOST_MATH_STD_USING
       const T r = term;
-      term *= (((a + n) / ((b + n) * (n + 1))) * z);
-      ++n;
+      next();
       return r;
     }
 
+    const T& current() const
+    {
+      return term;
+    }
+
+    void next()
+    {
+      advance(typename tools::inplace_arithmetic<T>::type());
+      ++n;
+    }
+
   private:
+    void advance(boost::mpl::false_)
+    {
+      term *= (((a + n) / ((b + n) * (n + 1))) * z);
+    }
+
+    void advance(boost::mpl::true_)
+    {
+      t1 = a; t1 += n;
+      t2 = b; t2 += n; t2 *= n + 1;
+      t1 /= t2; t1 *= z;
+      term *= t1;
+    }
+
     unsigned n;
     T term;
     const T a, b, z;
+    T t1, t2;
   };
 
   // partial specialization for 1F2
@@ -110,17 +184,39 @@
 
     T operator()()
     {
-      BOOST_MATH_STD_USING
       const T r = term;
-      term *= (((a + n) / ((b1 + n) * (b2 + n) * (n + 1))) * z);
-      ++n;
+      next();
       return r;
     }
 
+    const T& current() const
+    {
+      return term;
+    }
+
+    void next()
+    {
+      advance(typename tools::inplace_arithmetic<T>::type());
+      ++n;
+    }
+
   private:
+    void advance(boost::mpl::false_)
+    {
+      term *= (((a + n) / ((b1 + n) * (b2 + n) * (n + 1))) * z);
+    }
+
+    void advance(boost::mpl::true_)
+    {
+      t1 = b1; t1 += n; t2 = b2; t2 += n; t1 *= t2; t1 *= n + 1;
+      t2 = a; t2 += n; t2 /= t1; t2 *= z;
+      term *= t2;
+    }
+
     unsigned n;
     T term;
     const T a, b1, b2, z;
+    T t1, t2;
   };
 
   // partial specialization for 2F0
@@ -136,17 +232,39 @@
 
     T operator()()
     {
-      BOOST_MATH_STD_USING
       const T r = term;
-      term *= (((a1 + n) * (a2 + n) / (n + 1)) * z);
-      ++n;
+      next();
       return r;
     }
 
+    const T& current() const
+    {
+      return term;
+    }
+
+    void next()
+    {
+      advance(typename tools::inplace_arithmetic<T>::type());
+      ++n;
+    }
+
   private:
+    void advance(boost::mpl::false_)
+    {
+      term *= (((a1 + n) * (a2 + n) / (n + 1)) * z);
+    }
+
+    void advance(boost::mpl::true_)
+    {
+      t1 = a1; t1 += n; t2 = a2; t2 += n;
+      t1 *= t2; t1 /= n + 1; t1 *= z;
+      term *= t1;
+    }
+
     unsigned n;
     T term;
     const T a1, a2, z;
+    T t1, t2;
   };
 
   // partial specialization for 2F1
@@ -162,78 +280,245 @@
 
     T operator()()
     {
-      BOOST_MATH_STD_USING
       const T r = term;
-      term *= (((a1 + n) * (a2 + n) / ((b + n) * (n + 1))) * z);
-      ++n;
+      next();
       return r;
     }
 
+    const T& current() const
+    {
+      return term;
+    }
+
+    void next()
+    {
+      advance(typename tools::inplace_arithmetic<T>::type());
+      ++n;
+    }
+
   private:
+    void advance(boost::mpl::false_)
+    {
+      term *= (((a1 + n) * (a2 + n) / ((b + n) * (n + 1))) * z);
+    }
+
+    void advance(boost::mpl::true_)
+    {
+      t1 = a1; t1 += n; t2 = a2; t2 += n; t1 *= t2;
+      t2 = b; t2 += n; t2 *= n + 1;
+      t1 /= t2; t1 *= z;
+      term *= t1;
+    }
+
     unsigned n;
     T term;
     const T a1, a2, b, z;
+    T t1, t2;
   };
 
   // we don't need to define extra check and make a polinom from
   // series, when p(i) and q(i) are negative integers and p(i) >= q(i)
   // as described in functions.wolfram.alpha, because we always
   // stop summation when result (in this case numerator) is zero.
-  template <class T, unsigned p, unsigned q, class Policy>
-  inline T sum_pfq_series(detail::hypergeometric_pfq_generic_series_term<T, p, q>& term, const Policy& pol)
+  //
+  // The term is carried in tools::accumulation_traits<T, Policy>::type: either
+  // T itself or, when the precision policy asks for more digits than T
+  // has, double-double.
+  template <class Real, class Term, class T>
+  inline Real sum_pfq_series_imp(Term& term, const T& factor, boost::uintmax_t& max_iter, boost::mpl::false_)
   {
-    BOOST_MATH_STD_USING
+    const Real zero = 0;
+    return boost::math::tools::sum_series(term, factor, max_iter, zero);
+  }
+
+  // tools::sum_series, term for term the same sums and
+  // test, on variables that live as long as the loop
+  template <class Real, class Term, class T>
+  inline Real sum_pfq_series_imp(Term& term, const T& factor, boost::uintmax_t& max_iter, boost::mpl::true_)
+  {
+    const Real upper = factor;
+    const Real lower = -upper;
+
+    Real result = 0, ratio = 0;
+    boost::uintmax_t counter = max_iter;
+
+    do
+    {
+      result += term.current();
+      ratio = term.current();
+      ratio /= result;
+      term.next();
+    }
+    while (((ratio > upper) || (ratio < lower)) && --counter);
+
+    max_iter -= counter;
+    return result;
+  }
+
+  template <class T, class Real, unsigned p, unsigned q, class Policy>
+  inline T sum_pfq_series(detail::hypergeometric_pfq_generic_series_term<Real, p, q>& term, const Policy& pol)
+  {
+    typedef tools::accumulation_traits<T, Policy> accumulation_traits;
+
     boost::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
-#if BOOST_WORKAROUND(__BORLANDC__, BOOST_TESTED_AT(0x582))
-    const T zero = 0;
-    const T result = boost::math::tools::sum_series(term, boost::math::policies::get_epsilon<T, Policy>(), max_iter, zero);
-#else
-    const T result = boost::math::tools::sum_series(term, boost::math::policies::get_epsilon<T, Policy>(), max_iter);
-#endif
+    const T factor = accumulation_traits::tolerance(boost::math::policies::get_epsilon<T, Policy>());
+    const Real result = detail::sum_pfq_series_imp<Real>(term, factor, max_iter, typename tools::inplace_arithmetic<Real>::type());
     policies::check_series_iterations<T>("boost::math::hypergeometric_pfq_generic_series<%1%>(%1%,%1%,%1%)", max_iter, pol);
-    return result;
+    return accumulation_traits::value(result);
+  }
+
+  // one of two series summed side by side: step() adds a term and
+  // tells whether to go on, by the test of sum_pfq_series_imp
+  template <class Real, class Term, class T>
+  struct pfq_series_lane
+  {
+    pfq_series_lane(Term& term, const T& factor, boost::uintmax_t max_iter)
+       : term(term), factor(factor), upper(factor), lower(-upper), result(0), ratio(0), max_iter(max_iter), counter(max_iter), is_running(true)
+    {
+    }
+
+    bool running() const { return is_running; }
+    const Real& sum() const { return result; }
+    boost::uintmax_t terms() const { return max_iter - counter; }
+
+    void step()
+    {
+      is_running = step(typename tools::inplace_arithmetic<Real>::type());
+    }
+
+  private:
+    bool step(boost::mpl::false_)
+    {
+      BOOST_MATH_STD_USING // fabs
+
+      const Real next_term = term();
+      result += next_term;
+      return (fabs(factor) < fabs(next_term / result)) && --counter;
+    }
+
+    bool step(boost::mpl::true_)
+    {
+      result += term.current();
+      ratio = term.current();
+      ratio /= result;
+      term.next();
+      return ((ratio > upper) || (ratio < lower)) && --counter;
+    }
+
+    Term& term;
+    const T factor;
+    const Real upper, lower;
+    Real result, ratio;
+    const boost::uintmax_t max_iter;
+    boost::uintmax_t counter;
+    bool is_running;
+  };
+
+  // sum_pfq_series of two series at once, the independent chains of terms
+  // overlapping in the pipeline; each sum stops at its own test, so both
+  // come out as sum_pfq_series has them
+  template <class T, class Real, unsigned p, unsigned q, class Policy>
+  inline T sum_pfq_series_pair(detail::hypergeometric_pfq_generic_series_term<Real, p, q>& term, detail::hypergeometric_pfq_generic_series_term<Real, p, q>& other_term, T& other, const Policy& pol)
+  {
+    typedef tools::accumulation_traits<T, Policy> accumulation_traits;
+    typedef detail::pfq_series_lane<Real, detail::hypergeometric_pfq_generic_series_term<Real, p, q>, T> lane_type;
+
+    static const char* const function = "boost::math::hypergeometric_pfq_generic_series<%1%>(%1%,%1%,%1%)";
+
+    const boost::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+    const T factor = accumulation_traits::tolerance(boost::math::policies::get_epsilon<T, Policy>());
+
+    lane_type lane(term, factor, max_iter), other_lane(other_term, factor, max_iter);
+
+    while (lane.running() && other_lane.running())
+    {
+      lane.step();
+      other_lane.step();
+    }
+
+    while (lane.running())
+      lane.step();
+
+    while (other_lane.running())
+      other_lane.step();
+
+    policies::check_series_iterations<T>(function, lane.terms(), pol);
+    policies::check_series_iterations<T>(function, other_lane.terms(), pol);
+
+    other = accumulation_traits::value(other_lane.sum());
+    return accumulation_traits::value(lane.sum());
   }
 
   template <class T, class Policy>
   inline T hypergeometric_0f1_generic_series(const T& b, const T& z, const Policy& pol)
   {
-    detail::hypergeometric_pfq_generic_series_term<T, 0u, 1u> s(b, z);
-    return detail::sum_pfq_series(s, pol);
+    typedef typename tools::accumulation_traits<T, Policy>::type accumulation_type;
+    detail::hypergeometric_pfq_generic_series_term<accumulation_type, 0u, 1u> s(b, z);
+    return detail::sum_pfq_series<T>(s, pol);
   }
 
   template <class T, class Policy>
   inline T hypergeometric_1f0_generic_series(const T& a, const T& z, const Policy& pol)
   {
-    detail::hypergeometric_pfq_generic_series_term<T, 1u, 0u> s(a, z);
-    return detail::sum_pfq_series(s, pol);
+    typedef typename tools::accumulation_traits<T, Policy>::type accumulation_type;
+    detail::hypergeometric_pfq_generic_series_term<accumulation_type, 1u, 0u> s(a, z);
+    return detail::sum_pfq_series<T>(s, pol);
   }
 
   template <class T, class Policy>
   inline T hypergeometric_1f1_generic_series(const T& a, const T& b, const T& z, const Policy& pol)
   {
-    detail::hypergeometric_pfq_generic_series_term<T, 1u, 1u> s(a, b, z);
-    return detail::sum_pfq_series(s, pol);
+    typedef typename tools::accumulation_traits<T, Policy>::type accumulation_type;
+    detail::hypergeometric_pfq_generic_series_term<accumulation_type, 1u, 1u> s(a, b, z);
+    return detail::sum_pfq_series<T>(s, pol);
+  }
+
+  // 1F1(a, b, z) and, in other, 1F1(other_a, other_b, z) in one loop
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_generic_series_pair(const T& a, const T& b, const T& other_a, const T& other_b, const T& z, T& other, const Policy& pol)
+  {
+    typedef typename tools::accumulation_traits<T, Policy>::type accumulation_type;
+    detail::hypergeometric_pfq_generic_series_term<accumulation_type, 1u, 1u> s(a, b, z), other_s(other_a, other_b, z);
+    return detail::sum_pfq_series_pair<T>(s, other_s, other, pol);
   }
 
   template <class T, class Policy>
   inline T hypergeometric_1f2_generic_series(const T& a, const T& b1, const T& b2, const T& z, const Policy& pol)
   {
-    detail::hypergeometric_pfq_generic_series_term<T, 1u, 2u> s(a, b1, b2, z);
-    return detail::sum_pfq_series(s, pol);
+    typedef typename tools::accumulation_traits<T, Policy>::type accumulation_type;
+    detail::hypergeometric_pfq_generic_series_term<accumulation_type, 1u, 2u> s(a, b1, b2, z);
+    return detail::sum_pfq_series<T>(s, pol);
   }
 
   template <class T, class Policy>
   inline T hypergeometric_2f0_generic_series(const T& a1, const T& a2, const T& z, const Policy& pol)
   {
-    detail::hypergeometric_pfq_generic_series_term<T, 2u, 0u> s(a1, a2, z);
-    return detail::sum_pfq_series(s, pol);
+    typedef typename tools::accumulation_traits<T, Policy>::type accumulation_type;
+    detail::hypergeometric_pfq_generic_series_term<accumulation_type, 2u, 0u> s(a1, a2, z);
+    return detail::sum_pfq_series<T>(s, pol);
+  }
+
+  // 2F0 summed up to its smallest term, returns the sum
+  // and an estimate of its absolute error
+  template <class T, class Policy>
+  inline std::pair<T, T> hypergeometric_2f0_asymptotic_series(const T& a1, const T& a2, const T& z, const Policy& /* pol */)
+  {
+    typedef tools::accumulation_traits<T, Policy> accumulation_traits;
+    typedef typename accumulation_traits::type accumulation_type;
+
+    detail::hypergeometric_pfq_generic_series_term<accumulation_type, 2u, 0u> s(a1, a2, z);
+    boost::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+    const T factor = accumulation_traits::tolerance(boost::math::policies::get_epsilon<T, Policy>());
+    const std::pair<accumulation_type, accumulation_type> result = boost::math::tools::sum_asymptotic_series(s, factor, max_iter);
+    return std::make_pair(accumulation_traits::value(result.first), accumulation_traits::value(result.second));
   }
 
   template <class T, class Policy>
   inline T hypergeometric_2f1_generic_series(const T& a1, const T& a2, const T& b, const T& z, const Policy& pol)
   {
-    detail::hypergeometric_pfq_generic_series_term<T, 2u, 1u> s(a1, a2, b, z);
-    return detail::sum_pfq_series(s, pol);
+    typedef typename tools::accumulation_traits<T, Policy>::type accumulation_type;
+    detail::hypergeometric_pfq_generic_series_term<accumulation_type, 2u, 1u> s(a1, a2, b, z);
+    return detail::sum_pfq_series<T>(s, pol);
   }
 
   } } } // namespaces
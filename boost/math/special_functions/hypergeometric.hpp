@@ -11,12 +11,17 @@
 #ifndef _BOOST_HYPERGEOMETRIC_2014_04_07_HPP_
   #define _BOOST_HYPERGEOMETRIC_2014_04_07_HPP_
 
+  #include <iterator>
+  #include <vector>
+
   #include <boost/math/tools/series.hpp>
+  #include <boost/math/tools/chebyshev.hpp>
   #include <boost/math/policies/policy.hpp>
   #include <boost/math/policies/error_handling.hpp>
 
   #include <boost/math/special_functions/laguerre.hpp>
   #include <boost/math/special_functions/gamma.hpp>
+  #include <boost/math/special_functions/fpclassify.hpp>
 
   #include <boost/math/special_functions/detail/hypergeometric_series.hpp>
   #include <boost/math/special_functions/detail/hypergeometric_separated_series.hpp>
@@ -26,6 +31,13 @@
   #include <boost/math/special_functions/detail/hypergeometric_pade.hpp>
   #include <boost/math/special_functions/detail/hypergeometric_rational.hpp>
   #include <boost/math/special_functions/detail/hypergeometric_asym.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_1f1_grid.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_1f1_sweep.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_1f1_derivatives.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_1f1_parameter_derivatives.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_u.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_closed_forms.hpp>
+  #include <boost/math/special_functions/detail/hypergeometric_polynomial.hpp>
 
   namespace boost { namespace math { namespace detail {
 
@@ -58,9 +70,15 @@
         "boost::math::hypergeometric_0f1<%1%,%1%>(%1%, %1%)",
         "Evaluation of 0f1 with nonpositive integer b = %1%.", b, pol);
 
-    // evaluation through Taylor series looks
-    // more precisious than Bessel relation:
-    // detail::hypergeometric_0f1_bessel(b, z, pol);
+    T result;
+    if (detail::hypergeometric_0f1_closed_form_imp(b, z, result, pol))
+      return result;
+
+    // Bessel J for large negative z, where the series cancels,
+    // Bessel I only where the series gets long
+    if (detail::hypergeometric_0f1_bessel_region(b, z))
+      return detail::hypergeometric_0f1_bessel(b, z, pol);
+
     return detail::hypergeometric_0f1_generic_series(b, z, pol);
   }
 
@@ -80,45 +98,68 @@
     return pow(T(1 - z), T(-a));
   }
 
+  // hypergeometric_1f1_imp short of the series it ends in: returns
+  // hypergeometric_1f1_evaluated with result set, or else the series
+  // 1F1(a, b, z) comes down to, leaving result alone
   template <class T, class Policy>
-  inline T hypergeometric_1f1_imp(const T& a, const T& b, const T& z, const Policy& pol)
+  inline hypergeometric_1f1_series_kind hypergeometric_1f1_dispatch_imp(const T& a, const T& b, const T& z, T& result, const Policy& pol)
   {
     BOOST_MATH_STD_USING // exp, fabs, sqrt
 
     static const char* const function = "boost::math::hypergeometric_1f1<%1%,%1%,%1%>(%1%,%1%,%1%)";
 
     if ((z == 0) || (a == 0))
-      return T(1);
+    {
+      result = T(1);
+      return hypergeometric_1f1_evaluated;
+    }
 
     // undefined result:
     if (!detail::check_hypergeometric_1f1_parameters(a, b))
-      return policies::raise_domain_error<T>(
+    {
+      result = policies::raise_domain_error<T>(
         function,
         "Function is indeterminate for negative integer b = %1%.",
         b,
         pol);
+      return hypergeometric_1f1_evaluated;
+    }
 
     // other checks:
     if (a == -1)
-      return 1 - (z / b);
+    {
+      result = 1 - (z / b);
+      return hypergeometric_1f1_evaluated;
+    }
 
     const T b_minus_a = b - a;
 
     // 0f0 (exp) case;
     if (b_minus_a == 0)
-      return exp(z);
+    {
+      result = exp(z);
+      return hypergeometric_1f1_evaluated;
+    }
 
     if ((b_minus_a == -1))
     {
       // for negative integer a and b is reasonable to use truncated series - polynomial
       if ((a < 0) && (a == ceil(a)))
-        return detail::hypergeometric_1f1_generic_series(a, b, z, pol);
+        return hypergeometric_1f1_by_taylor;
 
-      return (1 + (z / b)) * exp(z);
+      result = (1 + (z / b)) * exp(z);
+      return hypergeometric_1f1_evaluated;
     }
 
     if ((a == 1) && (b == 2))
-      return (exp(z) - 1) / z;
+    {
+      result = (exp(z) - 1) / z;
+      return hypergeometric_1f1_evaluated;
+    }
+
+    // incomplete gamma, error and Bessel function cases
+    if (detail::hypergeometric_1f1_closed_form_imp(a, b, z, result, pol))
+      return hypergeometric_1f1_evaluated;
 
     // asymptotic expansion
     // check region
@@ -128,44 +169,165 @@
       if ((b > 0) || (b != floor(b)))
       {
         //check for poles in gamma for a
-        if (((a > 0) || (a != floor(a))) && (z > 0))
-          return detail::hypergeometric_1f1_asym_positive_series(a, b, z, pol);
+        if (((a > 0) || (a != floor(a))) && (z > 0) &&
+            detail::hypergeometric_1f1_asym_positive_series(a, b, z, result, pol))
+          return hypergeometric_1f1_evaluated;
 
         //check for poles in gamma for b
-        if (((b_minus_a > 0) || (b_minus_a != floor(b_minus_a))) && (z < 0))
-          return detail::hypergeometric_1f1_asym_negative_series(a, b, z, pol);
+        if (((b_minus_a > 0) || (b_minus_a != floor(b_minus_a))) && (z < 0) &&
+            detail::hypergeometric_1f1_asym_negative_series(a, b, z, result, pol))
+          return hypergeometric_1f1_evaluated;
       }
     }
 
     if (fabs(b) >= fabs(100 * z)) // TODO: extend to multuiprecision
-      return detail::hypergeometric_1f1_rational(a, b, z, pol);
+    {
+      result = detail::hypergeometric_1f1_rational(a, b, z, pol);
+      return hypergeometric_1f1_evaluated;
+    }
 
     if (z < -1)
     {
       if (a == 1)
-        return detail::hypergeometric_1f1_pade(b, z, pol);
+      {
+        result = detail::hypergeometric_1f1_pade(b, z, pol);
+        return hypergeometric_1f1_evaluated;
+      }
 
       // Let's otherwise make z positive (almost always)
       // by Kummer's transformation
       // (we also don't transform if z belongs to [-1,0])
-      return exp(z) * detail::hypergeometric_1f1_imp<T>(b_minus_a, b, -z, pol);
+      result = exp(z) * detail::hypergeometric_1f1_imp<T>(b_minus_a, b, -z, pol);
+      return hypergeometric_1f1_evaluated;
     }
 
+    // the plain series would cancel
+    if (detail::hypergeometric_1f1_13_3_8_region(a, b, z))
+      return hypergeometric_1f1_by_13_3_8;
+
     if (detail::hypergeometric_1f1_is_a_small_enough(a))
     {
       // TODO: this part has to be researched deeper
       const bool b_is_negative_and_greater_than_z = b < 0 ? (fabs(b) > fabs(z) ? 1 : 0) : 0;
       if ((a == ceil(a)) && !b_is_negative_and_greater_than_z)
-        return detail::hypergeometric_1f1_backward_recurrence_for_negative_a(a, b, z, pol);
+      {
+        result = detail::hypergeometric_1f1_backward_recurrence_for_negative_a(a, b, z, pol);
+        return hypergeometric_1f1_evaluated;
+      }
       else if ((2 * (z  * (b - (2 * a)))) > 0) // TODO: see when this methd is bad in opposite to usual taylor
-        return detail::hypergeometric_1f1_13_3_7_series(a, b, z, pol);
+      {
+        result = detail::hypergeometric_1f1_13_3_7_series(a, b, z, pol);
+        return hypergeometric_1f1_evaluated;
+      }
       else if (b < a)
-        return detail::hypergeometric_1f1_backward_recurrence_for_negative_b(a, b, z, pol);
+      {
+        result = detail::hypergeometric_1f1_backward_recurrence_for_negative_b(a, b, z, pol);
+        return hypergeometric_1f1_evaluated;
+      }
     }
 
+    return hypergeometric_1f1_by_taylor;
+  }
+
+  // the series hypergeometric_1f1_dispatch_imp leaves over
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_series_imp(const hypergeometric_1f1_series_kind kind, const T& a, const T& b, const T& z, const Policy& pol)
+  {
+    if (kind == hypergeometric_1f1_by_13_3_8)
+      return detail::hypergeometric_1f1_13_3_8_series(a, b, z, pol);
+
     return detail::hypergeometric_1f1_generic_series(a, b, z, pol);
   }
 
+  template <class T, class Policy>
+  inline T hypergeometric_1f1_imp(const T& a, const T& b, const T& z, const Policy& pol)
+  {
+    T result;
+    const hypergeometric_1f1_series_kind kind = detail::hypergeometric_1f1_dispatch_imp(a, b, z, result, pol);
+
+    if (kind == hypergeometric_1f1_evaluated)
+      return result;
+
+    return detail::hypergeometric_1f1_series_imp(kind, a, b, z, pol);
+  }
+
+  // 1F1(a, b, z) as a function of z alone, the oracle
+  // for hypergeometric_1f1_chebyshev
+  template <class ResultType, class T, class Policy>
+  struct hypergeometric_1f1_z_oracle
+  {
+    hypergeometric_1f1_z_oracle(const T& a, const T& b, const Policy& pol):
+      a(a), b(b), pol(pol)
+    {
+    }
+
+    ResultType operator()(const ResultType& z) const
+    {
+      return policies::checked_narrowing_cast<ResultType, Policy>(
+        detail::hypergeometric_1f1_imp<T>(a, b, static_cast<T>(z), pol),
+        "boost::math::hypergeometric_1f1_chebyshev<%1%>(%1%,%1%,%1%,%1%,%1%)");
+    }
+
+  private:
+    const T a, b;
+    const Policy& pol;
+  };
+
+  template <class ResultType, class T, class Policy>
+  inline tools::piecewise_chebyshev<ResultType> hypergeometric_1f1_chebyshev_imp(const T& a, const T& b, const ResultType& z_min, const ResultType& z_max, const ResultType& tolerance, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING // ldexp
+
+    static const char* const function = "boost::math::hypergeometric_1f1_chebyshev<%1%>(%1%,%1%,%1%,%1%,%1%)";
+
+    if (!detail::check_hypergeometric_1f1_parameters(a, b))
+    {
+      policies::raise_domain_error<ResultType>(
+        function,
+        "Function is indeterminate for negative integer b = %1%.",
+        static_cast<ResultType>(b),
+        pol);
+      return tools::piecewise_chebyshev<ResultType>();
+    }
+
+    if (!(boost::math::isfinite)(z_min) || !(boost::math::isfinite)(z_max) || !(z_min < z_max))
+    {
+      policies::raise_domain_error<ResultType>(
+        function,
+        "The interval [z_min, z_max] must be finite and non-empty, got z_max = %1%.",
+        z_max,
+        pol);
+      return tools::piecewise_chebyshev<ResultType>();
+    }
+
+    if (!(tolerance > 0))
+    {
+      policies::raise_domain_error<ResultType>(
+        function,
+        "The tolerance must be positive, got %1%.",
+        tolerance,
+        pol);
+      return tools::piecewise_chebyshev<ResultType>();
+    }
+
+    // can't do better than a few ulps of the oracle itself
+    const ResultType min_tolerance = ldexp(tools::epsilon<ResultType>(), 3);
+
+    const detail::hypergeometric_1f1_z_oracle<ResultType, T, Policy> oracle(a, b, pol);
+
+    const tools::piecewise_chebyshev<ResultType> result = tools::make_piecewise_chebyshev(oracle, z_min, z_max, (std::max)(tolerance, min_tolerance));
+
+    // the builder gave up: most likely the oracle is not accurate enough
+    if (result.max_error() > (std::max)(tolerance, min_tolerance))
+      policies::raise_evaluation_error<ResultType>(
+        function,
+        "The tolerance could not be met, the interpolant is good to %1% only.",
+        result.max_error(),
+        pol);
+
+    return result;
+  }
+
   template <class T, class Policy>
   inline T hypergeometric_1f2_imp(const T& a, const T& b1, const T& b2, const T& z, const Policy& pol)
   {
@@ -192,6 +354,15 @@
         pol);
     }
 
+    // the series needs O(|z|^(1/3)) terms and cancels
+    // for large negative z
+    if (detail::hypergeometric_1f2_asym_region(a, z))
+    {
+      T result;
+      if (detail::hypergeometric_1f2_asym_series(a, b1, b2, z, result, pol))
+        return result;
+    }
+
     return detail::hypergeometric_1f2_generic_series(a, b1, b2, z, pol);
   }
 
@@ -222,7 +393,17 @@
       }
     }
 
-    return detail::hypergeometric_2f0_generic_series(a1, a2, z, pol);
+    // the series diverges unless it terminates,
+    // its smallest term bounds the accuracy
+    const std::pair<T, T> result = detail::hypergeometric_2f0_asymptotic_series(a1, a2, z, pol);
+    if (!(result.second <= policies::get_epsilon<T, Policy>() * fabs(result.first)))
+      return policies::raise_evaluation_error<T>(
+        function,
+        "Divergent series has no term below epsilon, the truncated sum is %1%.",
+        result.first,
+        pol);
+
+    return result.first;
   }
 
   template <class T, class Policy>
@@ -241,6 +422,11 @@
         pol);
     }
 
+    // elementary and Legendre polynomial cases
+    T result;
+    if (detail::hypergeometric_2f1_closed_form_imp(a1, a2, b, z, result, pol))
+      return result;
+
     return detail::hypergeometric_2f1_generic_series(a1, a2, b, z, pol);
   }
 
@@ -325,6 +511,365 @@
     return hypergeometric_1f1(a, b, z, policies::policy<>());
   }
 
+  // Returns 1F1(a, b, z) and stores its first and second derivatives with
+  // respect to z in *first_derivative and *second_derivative (either may be
+  // null). The Taylor series, the asymptotic expansions and the recurrences
+  // give all three in one pass; the Bessel series regions and the second
+  // derivative after Kummer's transformation take one more evaluation of
+  // 1F1.
+  template <class T1, class T2, class T3, class Policy>
+  inline typename tools::promote_args<T1, T2, T3>::type hypergeometric_1f1_and_derivatives(T1 a, T2 b, T3 z,
+                                                                                           typename tools::promote_args<T1, T2, T3>::type* first_derivative,
+                                                                                           typename tools::promote_args<T1, T2, T3>::type* second_derivative,
+                                                                                           const Policy& /* pol */)
+  {
+    BOOST_FPU_EXCEPTION_GUARD
+    typedef typename tools::promote_args<T1, T2, T3>::type result_type;
+    typedef typename policies::evaluation<result_type, Policy>::type value_type;
+    typedef typename policies::normalise<
+       Policy,
+       policies::promote_float<false>,
+       policies::promote_double<false>,
+       policies::discrete_quantile<>,
+       policies::assert_undefined<> >::type forwarding_policy;
+    static const char* const function = "boost::math::hypergeometric_1f1_and_derivatives<%1%>(%1%,%1%,%1%)";
+
+    value_type first, second;
+    const value_type result = detail::hypergeometric_1f1_derivatives_imp<value_type>(
+                static_cast<value_type>(a),
+                static_cast<value_type>(b),
+                static_cast<value_type>(z),
+                first,
+                second,
+                forwarding_policy());
+
+    if (first_derivative)
+      *first_derivative = policies::checked_narrowing_cast<result_type, Policy>(first, function);
+    if (second_derivative)
+      *second_derivative = policies::checked_narrowing_cast<result_type, Policy>(second, function);
+
+    return policies::checked_narrowing_cast<result_type, Policy>(result, function);
+  }
+
+  template <class T1, class T2, class T3>
+  inline typename tools::promote_args<T1, T2, T3>::type hypergeometric_1f1_and_derivatives(T1 a, T2 b, T3 z,
+                                                                                           typename tools::promote_args<T1, T2, T3>::type* first_derivative,
+                                                                                           typename tools::promote_args<T1, T2, T3>::type* second_derivative = 0)
+  {
+    return hypergeometric_1f1_and_derivatives(a, b, z, first_derivative, second_derivative, policies::policy<>());
+  }
+
+  // Returns 1F1(a, b, z) and stores its partial derivatives with respect to
+  // the parameters a and b in *a_derivative and *b_derivative (either may
+  // be null), at about the cost of evaluating 1F1 alone. The exception is
+  // large negative a with z > 0 where 1F1 takes the Bessel series: there
+  // the recurrence on b is walked down from 100 z, several times the cost
+  // of 1F1 for large z. The derivatives are a domain error for
+  // non-positive integer b.
+  template <class T1, class T2, class T3, class Policy>
+  inline typename tools::promote_args<T1, T2, T3>::type hypergeometric_1f1_and_parameter_derivatives(T1 a, T2 b, T3 z,
+                                                                                                     typename tools::promote_args<T1, T2, T3>::type* a_derivative,
+                                                                                                     typename tools::promote_args<T1, T2, T3>::type* b_derivative,
+                                                                                                     const Policy& /* pol */)
+  {
+    BOOST_FPU_EXCEPTION_GUARD
+    typedef typename tools::promote_args<T1, T2, T3>::type result_type;
+    typedef typename policies::evaluation<result_type, Policy>::type value_type;
+    typedef typename policies::normalise<
+       Policy,
+       policies::promote_float<false>,
+       policies::promote_double<false>,
+       policies::discrete_quantile<>,
+       policies::assert_undefined<> >::type forwarding_policy;
+    static const char* const function = "boost::math::hypergeometric_1f1_and_parameter_derivatives<%1%>(%1%,%1%,%1%)";
+
+    value_type da, db;
+    const value_type result = detail::hypergeometric_1f1_parameter_derivatives_imp<value_type>(
+                static_cast<value_type>(a),
+                static_cast<value_type>(b),
+                static_cast<value_type>(z),
+                da,
+                db,
+                forwarding_policy());
+
+    if (a_derivative)
+      *a_derivative = policies::checked_narrowing_cast<result_type, Policy>(da, function);
+    if (b_derivative)
+      *b_derivative = policies::checked_narrowing_cast<result_type, Policy>(db, function);
+
+    return policies::checked_narrowing_cast<result_type, Policy>(result, function);
+  }
+
+  template <class T1, class T2, class T3>
+  inline typename tools::promote_args<T1, T2, T3>::type hypergeometric_1f1_and_parameter_derivatives(T1 a, T2 b, T3 z,
+                                                                                                     typename tools::promote_args<T1, T2, T3>::type* a_derivative,
+                                                                                                     typename tools::promote_args<T1, T2, T3>::type* b_derivative)
+  {
+    return hypergeometric_1f1_and_parameter_derivatives(a, b, z, a_derivative, b_derivative, policies::policy<>());
+  }
+
+  // Tricomi's confluent hypergeometric function U(a, b, z), the solution
+  // of Kummer's equation that decays as z^-a for large z. Only real z > 0
+  // is supported.
+  template <class T1, class T2, class T3, class Policy>
+  inline typename tools::promote_args<T1, T2, T3>::type hypergeometric_u(T1 a, T2 b, T3 z, const Policy& /* pol */)
+  {
+    BOOST_FPU_EXCEPTION_GUARD
+    typedef typename tools::promote_args<T1, T2, T3>::type result_type;
+    typedef typename policies::evaluation<result_type, Policy>::type value_type;
+    typedef typename policies::normalise<
+       Policy,
+       policies::promote_float<false>,
+       policies::promote_double<false>,
+       policies::discrete_quantile<>,
+       policies::assert_undefined<> >::type forwarding_policy;
+    return policies::checked_narrowing_cast<result_type, Policy>(
+          detail::hypergeometric_u_imp<value_type>(
+                static_cast<value_type>(a),
+                static_cast<value_type>(b),
+                static_cast<value_type>(z),
+                forwarding_policy()),
+          "boost::math::hypergeometric_u<%1%>(%1%,%1%,%1%)");
+  }
+
+  template <class T1, class T2, class T3>
+  inline typename tools::promote_args<T1, T2, T3>::type hypergeometric_u(T1 a, T2 b, T3 z)
+  {
+    return hypergeometric_u(a, b, z, policies::policy<>());
+  }
+
+  // Returns 1F1(a, b, z) and stores U(a, b, z) in *u (which may be null).
+  // Both come from one evaluation of 1F1 and its derivative, U being
+  // normalized against them by the Wronskian, so the pair costs little
+  // more than 1F1 alone. Only real z > 0 is supported. Unlike U, 1F1 is
+  // undefined for non-positive integer b: a domain error is raised for the
+  // pair then, and under a policy that doesn't throw *u still receives U.
+  template <class T1, class T2, class T3, class Policy>
+  inline typename tools::promote_args<T1, T2, T3>::type hypergeometric_1f1_and_u(T1 a, T2 b, T3 z,
+                                                                                 typename tools::promote_args<T1, T2, T3>::type* u,
+                                                                                 const Policy& /* pol */)
+  {
+    BOOST_FPU_EXCEPTION_GUARD
+    typedef typename tools::promote_args<T1, T2, T3>::type result_type;
+    typedef typename policies::evaluation<result_type, Policy>::type value_type;
+    typedef typename policies::normalise<
+       Policy,
+       policies::promote_float<false>,
+       policies::promote_double<false>,
+       policies::discrete_quantile<>,
+       policies::assert_undefined<> >::type forwarding_policy;
+    static const char* const function = "boost::math::hypergeometric_1f1_and_u<%1%>(%1%,%1%,%1%)";
+
+    value_type u_value;
+    const value_type result = detail::hypergeometric_1f1_and_u_imp<value_type>(
+                static_cast<value_type>(a),
+                static_cast<value_type>(b),
+                static_cast<value_type>(z),
+                u_value,
+                forwarding_policy());
+
+    if (u)
+      *u = policies::checked_narrowing_cast<result_type, Policy>(u_value, function);
+
+    return policies::checked_narrowing_cast<result_type, Policy>(result, function);
+  }
+
+  template <class T1, class T2, class T3>
+  inline typename tools::promote_args<T1, T2, T3>::type hypergeometric_1f1_and_u(T1 a, T2 b, T3 z,
+                                                                                 typename tools::promote_args<T1, T2, T3>::type* u)
+  {
+    return hypergeometric_1f1_and_u(a, b, z, u, policies::policy<>());
+  }
+
+  // Builds a piecewise Chebyshev interpolant of z -> 1F1(a, b, z) on [z_min, z_max]
+  // with relative error below tolerance (clamped to a few epsilon), using
+  // hypergeometric_1f1 as the oracle. The result evaluates in a few nanoseconds
+  // per point and reports the error measured while building as max_error().
+  // An evaluation error is raised when the tolerance can't be met; under a
+  // policy that ignores it the interpolant is returned as built.
+  template <class T1, class T2, class T3, class T4, class T5, class Policy>
+  inline tools::piecewise_chebyshev<typename tools::promote_args<T1, T2, T3, T4, T5>::type>
+    hypergeometric_1f1_chebyshev(T1 a, T2 b, T3 z_min, T4 z_max, T5 tolerance, const Policy& /* pol */)
+  {
+    BOOST_FPU_EXCEPTION_GUARD
+    typedef typename tools::promote_args<T1, T2, T3, T4, T5>::type result_type;
+    typedef typename policies::evaluation<result_type, Policy>::type value_type;
+    typedef typename policies::normalise<
+       Policy,
+       policies::promote_float<false>,
+       policies::promote_double<false>,
+       policies::discrete_quantile<>,
+       policies::assert_undefined<> >::type forwarding_policy;
+    return detail::hypergeometric_1f1_chebyshev_imp<result_type>(
+                static_cast<value_type>(a),
+                static_cast<value_type>(b),
+                static_cast<result_type>(z_min),
+                static_cast<result_type>(z_max),
+                static_cast<result_type>(tolerance),
+                forwarding_policy());
+  }
+
+  template <class T1, class T2, class T3, class T4, class T5>
+  inline tools::piecewise_chebyshev<typename tools::promote_args<T1, T2, T3, T4, T5>::type>
+    hypergeometric_1f1_chebyshev(T1 a, T2 b, T3 z_min, T4 z_max, T5 tolerance)
+  {
+    return hypergeometric_1f1_chebyshev(a, b, z_min, z_max, tolerance, policies::policy<>());
+  }
+
+  // The terminating series 1F1(-n; b; z) as a polynomial of degree n in z,
+  // for many z at the same parameters: the coefficients are formed once,
+  // scaled against overflow, and each point then costs n multiplications
+  // (see tools::scaled_polynomial). The terms alternate in sign for z > 0
+  // when b > 0, where hypergeometric_1f1 recurs on a instead; the error at
+  // a point is bounded through condition_number(z).
+  template <class T1, class T2, class Policy>
+  inline tools::scaled_polynomial<typename tools::promote_args<T1, T2>::type>
+    hypergeometric_1f1_polynomial(T1 a, T2 b, const Policy& /* pol */)
+  {
+    BOOST_FPU_EXCEPTION_GUARD
+    typedef typename tools::promote_args<T1, T2>::type result_type;
+    typedef typename policies::evaluation<result_type, Policy>::type value_type;
+    typedef typename policies::normalise<
+       Policy,
+       policies::promote_float<false>,
+       policies::promote_double<false>,
+       policies::discrete_quantile<>,
+       policies::assert_undefined<> >::type forwarding_policy;
+    return detail::hypergeometric_1f1_polynomial_imp<result_type>(
+                static_cast<value_type>(a),
+                static_cast<value_type>(b),
+                forwarding_policy());
+  }
+
+  template <class T1, class T2>
+  inline tools::scaled_polynomial<typename tools::promote_args<T1, T2>::type>
+    hypergeometric_1f1_polynomial(T1 a, T2 b)
+  {
+    return hypergeometric_1f1_polynomial(a, b, policies::policy<>());
+  }
+
+  // The same for 2F1(a1, a2; b; z) when a1 or a2 is a non-positive integer,
+  // a Jacobi polynomial up to normalization
+  template <class T1, class T2, class T3, class Policy>
+  inline tools::scaled_polynomial<typename tools::promote_args<T1, T2, T3>::type>
+    hypergeometric_2f1_polynomial(T1 a1, T2 a2, T3 b, const Policy& /* pol */)
+  {
+    BOOST_FPU_EXCEPTION_GUARD
+    typedef typename tools::promote_args<T1, T2, T3>::type result_type;
+    typedef typename policies::evaluation<result_type, Policy>::type value_type;
+    typedef typename policies::normalise<
+       Policy,
+       policies::promote_float<false>,
+       policies::promote_double<false>,
+       policies::discrete_quantile<>,
+       policies::assert_undefined<> >::type forwarding_policy;
+    return detail::hypergeometric_2f1_polynomial_imp<result_type>(
+                static_cast<value_type>(a1),
+                static_cast<value_type>(a2),
+                static_cast<value_type>(b),
+                forwarding_policy());
+  }
+
+  template <class T1, class T2, class T3>
+  inline tools::scaled_polynomial<typename tools::promote_args<T1, T2, T3>::type>
+    hypergeometric_2f1_polynomial(T1 a1, T2 a2, T3 b)
+  {
+    return hypergeometric_2f1_polynomial(a1, a2, b, policies::policy<>());
+  }
+
+  // Fills a dense buffer with 1F1 over the Cartesian product of the a, b and z
+  // axes (see hypergeometric_grid_layout for the storage order). Unit spaced
+  // runs of the a or b axis are walked by recurrence between direct anchors,
+  // the b axis is split between threads (threads == 0 means hardware concurrency).
+  template <class RandomAccessIterator1, class RandomAccessIterator2, class RandomAccessIterator3, class RandomAccessIterator4, class Policy>
+  inline void hypergeometric_1f1_grid(RandomAccessIterator1 a_first, RandomAccessIterator1 a_last,
+                                      RandomAccessIterator2 b_first, RandomAccessIterator2 b_last,
+                                      RandomAccessIterator3 z_first, RandomAccessIterator3 z_last,
+                                      RandomAccessIterator4 result,
+                                      hypergeometric_grid_layout layout,
+                                      unsigned threads,
+                                      const Policy& /* pol */)
+  {
+    BOOST_FPU_EXCEPTION_GUARD
+    typedef typename std::iterator_traits<RandomAccessIterator1>::value_type T1;
+    typedef typename std::iterator_traits<RandomAccessIterator2>::value_type T2;
+    typedef typename std::iterator_traits<RandomAccessIterator3>::value_type T3;
+    typedef typename tools::promote_args<T1, T2, T3>::type result_type;
+    typedef typename policies::evaluation<result_type, Policy>::type value_type;
+    typedef typename policies::normalise<
+       Policy,
+       policies::promote_float<false>,
+       policies::promote_double<false>,
+       policies::discrete_quantile<>,
+       policies::assert_undefined<> >::type forwarding_policy;
+
+    std::vector<value_type> a, b, z;
+    for (; a_first != a_last; ++a_first)
+      a.push_back(static_cast<value_type>(*a_first));
+    for (; b_first != b_last; ++b_first)
+      b.push_back(static_cast<value_type>(*b_first));
+    for (; z_first != z_last; ++z_first)
+      z.push_back(static_cast<value_type>(*z_first));
+
+    detail::hypergeometric_1f1_grid_imp<value_type, result_type>(a, b, z, result, layout, threads, forwarding_policy());
+  }
+
+  template <class RandomAccessIterator1, class RandomAccessIterator2, class RandomAccessIterator3, class RandomAccessIterator4>
+  inline void hypergeometric_1f1_grid(RandomAccessIterator1 a_first, RandomAccessIterator1 a_last,
+                                      RandomAccessIterator2 b_first, RandomAccessIterator2 b_last,
+                                      RandomAccessIterator3 z_first, RandomAccessIterator3 z_last,
+                                      RandomAccessIterator4 result,
+                                      hypergeometric_grid_layout layout = hypergeometric_grid_row_major,
+                                      unsigned threads = 0u)
+  {
+    hypergeometric_1f1_grid(a_first, a_last, b_first, b_last, z_first, z_last, result, layout, threads, policies::policy<>());
+  }
+
+  // 1F1(a, b, z[i]) for fixed a and b over many z, i < z_last - z_first, as
+  // in a dense scan of z. The points are walked outwards from z = 0 by Taylor
+  // steps of Kummer's equation and checked against direct evaluations every
+  // few steps. Points sorted by z are walked in place, others are sorted
+  // first; the points are split between threads (threads == 0 means
+  // hardware concurrency). The steps are taken in the evaluation type, so a
+  // precision policy that switches on compensated accumulation (see
+  // boost/math/tools/double_double.hpp) sharpens the direct evaluations only.
+  template <class T1, class T2, class RandomAccessIterator1, class RandomAccessIterator2, class Policy>
+  inline void hypergeometric_1f1_sweep(T1 a, T2 b,
+                                       RandomAccessIterator1 z_first, RandomAccessIterator1 z_last,
+                                       RandomAccessIterator2 result,
+                                       unsigned threads,
+                                       const Policy& /* pol */)
+  {
+    BOOST_FPU_EXCEPTION_GUARD
+    typedef typename std::iterator_traits<RandomAccessIterator1>::value_type T3;
+    typedef typename tools::promote_args<T1, T2, T3>::type result_type;
+    typedef typename policies::evaluation<result_type, Policy>::type value_type;
+    typedef typename policies::normalise<
+       Policy,
+       policies::promote_float<false>,
+       policies::promote_double<false>,
+       policies::discrete_quantile<>,
+       policies::assert_undefined<> >::type forwarding_policy;
+
+    std::vector<value_type> z;
+    for (; z_first != z_last; ++z_first)
+      z.push_back(static_cast<value_type>(*z_first));
+
+    detail::hypergeometric_1f1_sweep_imp<value_type, result_type>(
+      static_cast<value_type>(a),
+      static_cast<value_type>(b),
+      z, result, threads, forwarding_policy());
+  }
+
+  template <class T1, class T2, class RandomAccessIterator1, class RandomAccessIterator2>
+  inline void hypergeometric_1f1_sweep(T1 a, T2 b,
+                                       RandomAccessIterator1 z_first, RandomAccessIterator1 z_last,
+                                       RandomAccessIterator2 result,
+                                       unsigned threads = 0u)
+  {
+    hypergeometric_1f1_sweep(a, b, z_first, z_last, result, threads, policies::policy<>());
+  }
+
   template <class T1, class T2, class T3, class T4, class Policy>
   inline typename tools::promote_args<T1, T2, T3, T4>::type hypergeometric_1f2(T1 a, T2 b1, T3 b2, T4 z, const Policy& /* pol */)
   {
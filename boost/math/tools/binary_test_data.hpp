@@ -0,0 +1,204 @@
+//  (C) Copyright Anton Bikineev 2014
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_BINARY_TEST_DATA_HPP_
+  #define BOOST_MATH_TOOLS_BINARY_TEST_DATA_HPP_
+
+  #include <cstddef>
+  #include <cstring>
+  #include <iterator>
+  #include <limits>
+  #include <ostream>
+  #include <stdexcept>
+  #include <string>
+
+  #include <boost/array.hpp>
+  #include <boost/cstdint.hpp>
+  #include <boost/static_assert.hpp>
+  #include <boost/throw_exception.hpp>
+  #include <boost/type_traits/is_floating_point.hpp>
+  #include <boost/interprocess/file_mapping.hpp>
+  #include <boost/interprocess/mapped_region.hpp>
+
+  // Reference data as a file instead of boost::array initializers that the
+  // compiler has to digest: a fixed 64 byte header followed by rows x columns
+  // values of one built-in floating point type, packed row after row in the
+  // byte order of the machine that wrote them.
+  //
+  //   offset  size  field
+  //        0     8  magic "BMTDATA" and a terminating zero
+  //        8     4  byte order mark 0x01020304
+  //       12     4  format version, binary_test_data_version
+  //       16     4  sizeof the stored type
+  //       20     4  std::numeric_limits<stored type>::digits
+  //       24     4  columns
+  //       28     4  zero
+  //       32     8  rows
+  //       40    24  zero
+  //
+  // The size and digits identify the stored type as float, double or long
+  // double on the reading machine, which must agree with the writer about
+  // the layout of that type. Files are mapped into memory rather than read,
+  // so data sets of any size cost only the pages actually touched.
+
+  namespace boost { namespace math { namespace tools {
+
+  static const boost::uint32_t binary_test_data_version = 1u;
+
+  struct binary_test_data_header
+  {
+    char magic[8];
+    boost::uint32_t byte_order;
+    boost::uint32_t version;
+    boost::uint32_t value_size;
+    boost::uint32_t digits;
+    boost::uint32_t columns;
+    boost::uint32_t reserved;
+    boost::uint64_t rows;
+    char padding[24];
+  };
+
+  BOOST_STATIC_ASSERT(sizeof(binary_test_data_header) == 64u);
+
+  namespace detail {
+
+  inline const char* binary_test_data_magic()
+  {
+    return "BMTDATA";
+  }
+
+  // the values may be misaligned for T in the mapping and
+  // may have a different type, hence the copy
+  template <class S, class T>
+  inline T binary_test_data_load(const unsigned char* p)
+  {
+    S s;
+    std::memcpy(&s, p, sizeof(S));
+    return static_cast<T>(s);
+  }
+
+  template <class S, class T>
+  inline bool binary_test_data_select(const binary_test_data_header& header, T (*&load)(const unsigned char*))
+  {
+    if ((header.value_size != sizeof(S)) || (header.digits != static_cast<boost::uint32_t>(std::numeric_limits<S>::digits)))
+      return false;
+
+    load = &detail::binary_test_data_load<S, T>;
+    return true;
+  }
+
+  } // namespace detail
+
+  // writes the rows of a range, such as test_data<T> or a boost::array of
+  // boost::arrays, stored as S; every row has to have the same size
+  template <class S, class Rows>
+  inline void write_binary_test_data(std::ostream& os, const Rows& rows)
+  {
+    BOOST_STATIC_ASSERT(boost::is_floating_point<S>::value);
+
+    binary_test_data_header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, detail::binary_test_data_magic(), sizeof(header.magic));
+    header.byte_order = 0x01020304u;
+    header.version = binary_test_data_version;
+    header.value_size = sizeof(S);
+    header.digits = std::numeric_limits<S>::digits;
+    header.rows = std::distance(rows.begin(), rows.end());
+    header.columns = header.rows ? static_cast<boost::uint32_t>(rows.begin()->size()) : 0u;
+
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (typename Rows::const_iterator row = rows.begin(); row != rows.end(); ++row)
+    {
+      if (row->size() != header.columns)
+        boost::throw_exception(std::invalid_argument("write_binary_test_data: rows of different sizes."));
+
+      for (std::size_t j = 0; j < header.columns; ++j)
+      {
+        const S value = static_cast<S>((*row)[j]);
+        os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+      }
+    }
+
+    if (!os)
+      boost::throw_exception(std::runtime_error("write_binary_test_data: write failed."));
+  }
+
+  // read only view of a file written by write_binary_test_data with N
+  // columns, usable wherever the boost::array tables are: rows are
+  // converted to boost::array<T, N> on access
+  template <class T, std::size_t N>
+  class binary_test_data
+  {
+  public:
+    typedef boost::array<T, N> value_type;
+    typedef std::size_t size_type;
+
+    explicit binary_test_data(const char* path):
+      file(path, boost::interprocess::read_only),
+      region(file, boost::interprocess::read_only)
+    {
+      const std::string where = std::string("binary_test_data: ") + path + ": ";
+
+      binary_test_data_header header;
+      if (region.get_size() < sizeof(header))
+        boost::throw_exception(std::runtime_error(where + "too short for the header."));
+      std::memcpy(&header, region.get_address(), sizeof(header));
+
+      if (std::memcmp(header.magic, detail::binary_test_data_magic(), sizeof(header.magic)) != 0)
+        boost::throw_exception(std::runtime_error(where + "not a binary test data file."));
+      if (header.byte_order != 0x01020304u)
+        boost::throw_exception(std::runtime_error(where + "written with a different byte order."));
+      if (header.version != binary_test_data_version)
+        boost::throw_exception(std::runtime_error(where + "unsupported format version."));
+      if (header.columns != N)
+        boost::throw_exception(std::runtime_error(where + "unexpected number of columns."));
+
+      if (!detail::binary_test_data_select<float>(header, load) &&
+          !detail::binary_test_data_select<double>(header, load) &&
+          !detail::binary_test_data_select<long double>(header, load))
+        boost::throw_exception(std::runtime_error(where + "values of a type unknown to this machine."));
+
+      if ((region.get_size() - sizeof(header)) / (N * header.value_size) < header.rows)
+        boost::throw_exception(std::runtime_error(where + "truncated."));
+
+      rows = static_cast<size_type>(header.rows);
+      row_size = N * header.value_size;
+      value_size = header.value_size;
+      values = static_cast<const unsigned char*>(region.get_address()) + sizeof(header);
+    }
+
+    size_type size() const
+    {
+      return rows;
+    }
+
+    value_type operator[](size_type i) const
+    {
+      const unsigned char* p = values + (i * row_size);
+
+      value_type row;
+      for (std::size_t j = 0; j < N; ++j, p += value_size)
+        row[j] = load(p);
+
+      return row;
+    }
+
+  private:
+    binary_test_data(const binary_test_data&);
+    binary_test_data& operator=(const binary_test_data&);
+
+    boost::interprocess::file_mapping file;
+    boost::interprocess::mapped_region region;
+    const unsigned char* values;
+    size_type rows;
+    std::size_t row_size;
+    std::size_t value_size;
+    T (*load)(const unsigned char*);
+  };
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_TOOLS_BINARY_TEST_DATA_HPP_
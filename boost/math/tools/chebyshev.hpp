@@ -0,0 +1,302 @@
+//  (C) Copyright Anton Bikineev 2014
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_CHEBYSHEV_HPP_
+  #define BOOST_MATH_TOOLS_CHEBYSHEV_HPP_
+
+  #include <algorithm>
+  #include <cstddef>
+  #include <vector>
+
+  #include <boost/assert.hpp>
+
+  #include <boost/math/tools/config.hpp>
+  #include <boost/math/tools/precision.hpp>
+  #include <boost/math/constants/constants.hpp>
+
+  // Piecewise Chebyshev interpolation of a smooth function on [lower, upper].
+  // The builder samples the function at Chebyshev nodes of each piece and
+  // bisects pieces whose expansion does not reproduce the function to the
+  // requested tolerance at the points halfway between the nodes.
+  // Evaluation is a binary search for the piece followed by Clenshaw's
+  // recurrence.
+
+  namespace boost { namespace math { namespace tools {
+
+  template <class T>
+  class piecewise_chebyshev
+  {
+  public:
+    typedef T value_type;
+
+    piecewise_chebyshev(): max_err(0)
+    {
+    }
+
+    // f(x) for x in [lower(), upper()]
+    T operator()(const T& x) const
+    {
+      BOOST_ASSERT(!pieces.empty());
+      BOOST_ASSERT((x >= bounds.front()) && (x <= bounds.back()));
+
+      // bounds[i] is the lower end of the i-th piece
+      std::size_t i = std::upper_bound(bounds.begin() + 1, bounds.end() - 1, x) - (bounds.begin() + 1);
+
+      return clenshaw(i, x);
+    }
+
+    // *out++ = f(*first++) for each point of [first, last);
+    // consecutive points falling into the same piece skip the search
+    template <class InputIterator, class OutputIterator>
+    OutputIterator evaluate(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+      BOOST_ASSERT(!pieces.empty());
+
+      std::size_t i = 0;
+      for (; first != last; ++first, ++out)
+      {
+        const T x = *first;
+        BOOST_ASSERT((x >= bounds.front()) && (x <= bounds.back()));
+
+        // a shared end belongs to the upper piece, as in operator()
+        if ((x < bounds[i]) || ((x >= bounds[i + 1]) && (i + 1 < pieces.size())))
+          i = std::upper_bound(bounds.begin() + 1, bounds.end() - 1, x) - (bounds.begin() + 1);
+
+        *out = clenshaw(i, x);
+      }
+
+      return out;
+    }
+
+    // largest error observed against the oracle while building
+    T max_error() const { return max_err; }
+
+    T lower() const { return bounds.front(); }
+    T upper() const { return bounds.back(); }
+
+    // number of pieces and total number of stored coefficients
+    std::size_t size() const { return pieces.size(); }
+    std::size_t coefficient_count() const
+    {
+      std::size_t result = 0;
+      for (std::size_t i = 0; i < pieces.size(); ++i)
+        result += pieces[i].size();
+      return result;
+    }
+
+    // piece [lower_bound, upper_bound) with expansion
+    // c[0]/2 + c[1]T1(t) + ... , pieces are appended left to right
+    void push_back(const T& lower_bound, const T& upper_bound, const std::vector<T>& c, const T& error)
+    {
+      BOOST_ASSERT(bounds.empty() || (bounds.back() == lower_bound));
+
+      if (bounds.empty())
+        bounds.push_back(lower_bound);
+      bounds.push_back(upper_bound);
+      pieces.push_back(c);
+
+      if (error > max_err)
+        max_err = error;
+    }
+
+    // appends the pieces of an interpolant starting at upper()
+    void append(const piecewise_chebyshev& other)
+    {
+      BOOST_ASSERT(bounds.empty() || other.bounds.empty() || (bounds.back() == other.bounds.front()));
+
+      if (other.pieces.empty())
+        return;
+
+      bounds.insert(bounds.end(), other.bounds.begin() + (bounds.empty() ? 0 : 1), other.bounds.end());
+      pieces.insert(pieces.end(), other.pieces.begin(), other.pieces.end());
+
+      if (other.max_err > max_err)
+        max_err = other.max_err;
+    }
+
+  private:
+    T clenshaw(std::size_t i, const T& x) const
+    {
+      const std::vector<T>& c = pieces[i];
+      const T t = ((2 * x) - (bounds[i] + bounds[i + 1])) / (bounds[i + 1] - bounds[i]);
+      const T two_t = 2 * t;
+
+      T b1 = 0, b2 = 0;
+      for (std::size_t k = c.size() - 1; k > 0; --k)
+      {
+        const T b0 = (two_t * b1) - b2 + c[k];
+        b2 = b1;
+        b1 = b0;
+      }
+
+      return (t * b1) - b2 + (c[0] / 2);
+    }
+
+    std::vector<T> bounds;
+    std::vector<std::vector<T> > pieces;
+    T max_err;
+  };
+
+  namespace detail {
+
+  // coefficients of the degree n - 1 interpolant through
+  // f at the Chebyshev points of the first kind of [l, u]
+  template <class T, class Functor>
+  inline T chebyshev_fit_piece(Functor& f, const T& l, const T& u, unsigned n, std::vector<T>& c)
+  {
+    BOOST_MATH_STD_USING // cos, fabs
+
+    const T pi = boost::math::constants::pi<T>();
+    const T half_width = (u - l) / 2, middle = (u + l) / 2;
+
+    std::vector<T> values(n);
+    T scale = 0;
+    for (unsigned j = 0; j < n; ++j)
+    {
+      values[j] = f(T(middle + half_width * cos(pi * (j + T(0.5)) / n)));
+      scale = (std::max)(scale, T(fabs(values[j])));
+    }
+
+    c.assign(n, T(0));
+    for (unsigned k = 0; k < n; ++k)
+    {
+      T sum = 0;
+      for (unsigned j = 0; j < n; ++j)
+        sum += values[j] * cos(pi * k * (j + T(0.5)) / n);
+      c[k] = 2 * sum / n;
+    }
+
+    return scale;
+  }
+
+  // the expansion of f on [l, u] with its error
+  template <class T>
+  struct chebyshev_piece
+  {
+    T lower, upper;
+    std::vector<T> c;
+    T error;
+  };
+
+  // fits f on [l, u] and checks the fit against f; costs
+  // 2 * max_degree + 3 calls of f
+  template <class T, class Functor>
+  inline void chebyshev_fit_and_check(Functor& f, const T& l, const T& u, const T& tolerance, unsigned max_degree, chebyshev_piece<T>& result)
+  {
+    BOOST_MATH_STD_USING // cos, fabs
+
+    std::vector<T>& c = result.c;
+    const T scale = detail::chebyshev_fit_piece(f, l, u, max_degree + 1, c);
+
+    // drop the tail that is negligible at the requested tolerance
+    std::size_t size = c.size();
+    while ((size > 1) && (fabs(c[size - 1]) <= tolerance * scale / 4))
+      --size;
+    c.resize(size);
+
+    piecewise_chebyshev<T> piece;
+    piece.push_back(l, u, c, T(0));
+
+    // check against f halfway between the nodes: the error is relative
+    // to f, but to tolerance times the piece's magnitude near zeros of f
+    const T pi = boost::math::constants::pi<T>();
+    const T half_width = (u - l) / 2, middle = (u + l) / 2;
+
+    T error = 0;
+    for (unsigned j = 0; j <= max_degree + 1; ++j)
+    {
+      const T x = middle + half_width * cos(pi * j / (max_degree + 1));
+      const T exact = f(x);
+      const T floor = (std::max)(T(fabs(exact)), T(scale * tolerance));
+
+      error = (std::max)(error, T(fabs(piece(x) - exact) / floor));
+    }
+
+    result.lower = l;
+    result.upper = u;
+    result.error = error;
+  }
+
+  // appends piece, or its halves where they do better, to result and
+  // returns the error of what was appended; stale counts the bisections
+  // in a row that failed to improve on their parent, fits the pieces
+  // that may still be fitted
+  template <class T, class Functor>
+  inline T chebyshev_build_piece(Functor& f, piecewise_chebyshev<T>& result, const chebyshev_piece<T>& piece,
+                                    const T& tolerance, unsigned max_degree, unsigned depth, unsigned max_depth,
+                                    unsigned stale, std::size_t& fits)
+  {
+    // near zeros of f a bisection may well do worse before it does better,
+    // but once the fit is down to the noise in f itself it never will:
+    // give up after this many bisections in a row without improvement
+    static const unsigned max_stale = 2u;
+
+    const T split = (piece.lower + piece.upper) / 2;
+    if ((piece.error > tolerance) && (depth < max_depth) && (fits >= 2u) && (split > piece.lower) && (split < piece.upper))
+    {
+      fits -= 2u;
+
+      chebyshev_piece<T> lower_half, upper_half;
+      detail::chebyshev_fit_and_check(f, piece.lower, split, tolerance, max_degree, lower_half);
+      detail::chebyshev_fit_and_check(f, split, piece.upper, tolerance, max_degree, upper_half);
+
+      const bool improved = (std::max)(lower_half.error, upper_half.error) < piece.error;
+      if (improved || (stale < max_stale))
+      {
+        const unsigned next_stale = improved ? 0u : stale + 1u;
+
+        // the lower half may take no more than half of what is left,
+        // so that the upper one is not starved
+        std::size_t lower_fits = fits / 2;
+        fits -= lower_fits;
+
+        piecewise_chebyshev<T> halves;
+        const T lower_error = detail::chebyshev_build_piece(f, halves, lower_half, tolerance, max_degree, depth + 1, max_depth, next_stale, lower_fits);
+        fits += lower_fits;
+        const T upper_error = detail::chebyshev_build_piece(f, halves, upper_half, tolerance, max_degree, depth + 1, max_depth, next_stale, fits);
+        const T halves_error = (std::max)(lower_error, upper_error);
+
+        if (halves_error < piece.error)
+        {
+          result.append(halves);
+          return halves_error;
+        }
+      }
+    }
+
+    result.push_back(piece.lower, piece.upper, piece.c, piece.error);
+    return piece.error;
+  }
+
+  } // namespace detail
+
+  // builds a piecewise Chebyshev interpolant of f on [lower, upper] with
+  // relative error below tolerance (measured against the magnitude of the
+  // piece close to zeros of f): pieces carry at most max_degree + 1
+  // coefficients and are bisected at most max_depth times, and no more
+  // than max_fits pieces are fitted, each for 2 * max_degree + 3 calls of f.
+  // Bisection also stops where a few in a row fail to improve the error.
+  // The tolerance is then not met, which the caller tells from max_error().
+  template <class T, class Functor>
+  inline piecewise_chebyshev<T> make_piecewise_chebyshev(Functor f, const T& lower, const T& upper, const T& tolerance, unsigned max_degree = 32u, unsigned max_depth = 16u, std::size_t max_fits = 1024u)
+  {
+    BOOST_ASSERT(lower < upper);
+    BOOST_ASSERT(max_degree > 0u);
+    BOOST_ASSERT(max_fits > 0u);
+
+    std::size_t fits = max_fits - 1u;
+
+    detail::chebyshev_piece<T> whole;
+    detail::chebyshev_fit_and_check(f, lower, upper, tolerance, max_degree, whole);
+
+    piecewise_chebyshev<T> result;
+    detail::chebyshev_build_piece(f, result, whole, tolerance, max_degree, 0u, max_depth, 0u, fits);
+
+    return result;
+  }
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_TOOLS_CHEBYSHEV_HPP_
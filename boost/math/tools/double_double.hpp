@@ -0,0 +1,234 @@
+//  (C) Copyright Anton Bikineev 2014
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_DOUBLE_DOUBLE_HPP_
+  #define BOOST_MATH_TOOLS_DOUBLE_DOUBLE_HPP_
+
+  #include <limits>
+
+  #include <boost/cstdint.hpp>
+  #include <boost/mpl/bool.hpp>
+  #include <boost/type_traits/is_floating_point.hpp>
+
+  #include <boost/math/tools/config.hpp>
+  #include <boost/math/policies/policy.hpp>
+
+  // Unevaluated sums hi + lo of two floating point numbers built on the
+  // error-free transformations of Knuth (two_sum) and Dekker (two_product),
+  // giving roughly twice the precision of T at a few times its cost.
+  // Only meaningful for binary built-in types, and only without
+  // value-unsafe optimizations such as -ffast-math, which fold the
+  // rounding error terms away.
+  //
+  // The kernels that support it (series, Luke's rational and Pade
+  // approximations of 1F1) accumulate in double-double when the precision
+  // policy asks for more digits than T has, policy<digits2<106> > for
+  // double, say, which elsewhere is capped at the digits of T.  They then
+  // deliver up to twice the digits of T before the final rounding, at
+  // 20 to 40 times the cost of the plain evaluation.
+
+  namespace boost { namespace math { namespace tools {
+
+  template <class T, class Policy>
+  struct compensated_accumulation: boost::mpl::bool_<
+        boost::is_floating_point<T>::value && (std::numeric_limits<T>::radix == 2)
+        && (Policy::precision_type::value > std::numeric_limits<T>::digits)
+        > {};
+
+  // s + e == a + b exactly; the inputs are copied
+  // so that they may alias the outputs
+  template <class T>
+  inline void two_sum(const T a, const T b, T& s, T& e)
+  {
+    s = a + b;
+    const T v = s - a;
+    e = (a - (s - v)) + (b - v);
+  }
+
+  // s + e == a + b exactly, provided |a| >= |b|
+  template <class T>
+  inline void fast_two_sum(const T a, const T b, T& s, T& e)
+  {
+    s = a + b;
+    e = b - (s - a);
+  }
+
+  // hi + lo == a exactly, both halves carrying at most half the digits
+  template <class T>
+  inline void dekker_split(const T& a, T& hi, T& lo)
+  {
+    BOOST_MATH_STD_USING // fabs, ldexp
+
+    // compile time constants for the built-in types, no guarded statics
+    const int half_digits = (std::numeric_limits<T>::digits + 1) / 2;
+    const T splitter = static_cast<T>(static_cast<boost::uintmax_t>(1u) << half_digits) + 1;
+
+    if (fabs(a) > (std::numeric_limits<T>::max)() / splitter)
+    {
+      // scale to avoid overflow in the product with the splitter
+      const T scaled = ldexp(a, -half_digits - 1);
+      const T t = splitter * scaled;
+      hi = t - (t - scaled);
+      lo = scaled - hi;
+      hi = ldexp(hi, half_digits + 1);
+      lo = ldexp(lo, half_digits + 1);
+      return;
+    }
+
+    const T t = splitter * a;
+    hi = t - (t - a);
+    lo = a - hi;
+  }
+
+  // p + e == a * b exactly (barring underflow)
+  template <class T>
+  inline void two_product(const T a, const T b, T& p, T& e)
+  {
+    p = a * b;
+
+    T a_hi, a_lo, b_hi, b_lo;
+    tools::dekker_split(a, a_hi, a_lo);
+    tools::dekker_split(b, b_hi, b_lo);
+
+    e = (((a_hi * b_hi) - p) + (a_hi * b_lo) + (a_lo * b_hi)) + (a_lo * b_lo);
+  }
+
+  template <class T>
+  class double_double
+  {
+  public:
+    typedef T value_type;
+
+    double_double(): h(0), l(0)
+    {
+    }
+
+    double_double(const T& x): h(x), l(0)
+    {
+    }
+
+    double_double(const T& hi, const T& lo)
+    {
+      tools::fast_two_sum(hi, lo, h, l);
+    }
+
+    const T& hi() const { return h; }
+    const T& lo() const { return l; }
+
+    // nearest T
+    T value() const { return h; }
+
+    double_double operator-() const { return double_double(-h, -l, 0); }
+
+    double_double& operator+=(const double_double& y) { return *this = *this + y; }
+    double_double& operator-=(const double_double& y) { return *this = *this - y; }
+    double_double& operator*=(const double_double& y) { return *this = *this * y; }
+    double_double& operator/=(const double_double& y) { return *this = *this / y; }
+
+    friend double_double operator+(const double_double& x, const double_double& y)
+    {
+      T s, e, t, f;
+      tools::two_sum(x.h, y.h, s, e);
+      tools::two_sum(x.l, y.l, t, f);
+      e += t;
+      tools::fast_two_sum(s, e, s, e);
+      e += f;
+      return double_double(s, e);
+    }
+
+    friend double_double operator+(const double_double& x, const T& y)
+    {
+      T s, e;
+      tools::two_sum(x.h, y, s, e);
+      e += x.l;
+      return double_double(s, e);
+    }
+
+    friend double_double operator+(const T& x, const double_double& y) { return y + x; }
+
+    friend double_double operator-(const double_double& x, const double_double& y) { return x + (-y); }
+    friend double_double operator-(const double_double& x, const T& y) { return x + (-y); }
+    friend double_double operator-(const T& x, const double_double& y) { return (-y) + x; }
+
+    friend double_double operator*(const double_double& x, const double_double& y)
+    {
+      T p, e;
+      tools::two_product(x.h, y.h, p, e);
+      e += (x.h * y.l) + (x.l * y.h);
+      return double_double(p, e);
+    }
+
+    friend double_double operator*(const double_double& x, const T& y)
+    {
+      T p, e;
+      tools::two_product(x.h, y, p, e);
+      e += x.l * y;
+      return double_double(p, e);
+    }
+
+    friend double_double operator*(const T& x, const double_double& y) { return y * x; }
+
+    // two steps of long division, accurate to a few units in the last
+    // place of the double length result
+    friend double_double operator/(const double_double& x, const double_double& y)
+    {
+      const T q1 = x.h / y.h;
+      const double_double r = x - (y * q1);
+      const T q2 = r.h / y.h;
+      return double_double(q1, q2);
+    }
+
+    friend double_double operator/(const double_double& x, const T& y)
+    {
+      const T q1 = x.h / y;
+      const double_double r = x - (double_double(y) * q1);
+      const T q2 = r.h / y;
+      return double_double(q1, q2);
+    }
+
+    friend double_double operator/(const T& x, const double_double& y) { return double_double(x) / y; }
+
+    friend bool operator<(const double_double& x, const double_double& y) { return (x.h < y.h) || ((x.h == y.h) && (x.l < y.l)); }
+    friend bool operator>(const double_double& x, const double_double& y) { return y < x; }
+    friend bool operator<=(const double_double& x, const double_double& y) { return !(y < x); }
+    friend bool operator>=(const double_double& x, const double_double& y) { return !(x < y); }
+    friend bool operator==(const double_double& x, const double_double& y) { return (x.h == y.h) && (x.l == y.l); }
+    friend bool operator!=(const double_double& x, const double_double& y) { return !(x == y); }
+
+    friend double_double fabs(const double_double& x) { return x.h < 0 ? -x : x; }
+
+  private:
+    // raw constructor, the pair is already normalized
+    double_double(const T& hi, const T& lo, int): h(hi), l(lo)
+    {
+    }
+
+    T h, l;
+  };
+
+  // type used by the kernels to carry sums and recurrences in, the
+  // convergence tolerance matching it and the conversion back to T
+  template <class T, class Policy, bool IsCompensated = compensated_accumulation<T, Policy>::value>
+  struct accumulation_traits
+  {
+    typedef T type;
+
+    static T tolerance(const T& eps) { return eps; }
+    static T value(const type& x) { return x; }
+  };
+
+  template <class T, class Policy>
+  struct accumulation_traits<T, Policy, true>
+  {
+    typedef double_double<T> type;
+
+    // twice the digits of T
+    static T tolerance(const T& eps) { return eps * eps; }
+    static T value(const type& x) { return x.value(); }
+  };
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_TOOLS_DOUBLE_DOUBLE_HPP_
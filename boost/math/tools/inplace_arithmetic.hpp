@@ -0,0 +1,55 @@
+//  (C) Copyright Anton Bikineev 2014
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_INPLACE_ARITHMETIC_HPP_
+  #define BOOST_MATH_TOOLS_INPLACE_ARITHMETIC_HPP_
+
+  #include <limits>
+
+  #include <boost/mpl/bool.hpp>
+  #include <boost/type_traits/is_floating_point.hpp>
+
+  #include <boost/math/tools/config.hpp>
+
+  // With multiprecision class types (boost::multiprecision::number over
+  // gmp, mpfr or cpp_dec_float backends) every intermediate value of an
+  // expression is a number of its own: a heap allocation with the gmp and
+  // mpfr backends, a copy of all the limbs with any of them. Compound
+  // assignments and products with built-in integers work on the storage
+  // of their left operand instead, so the kernels that support it (the
+  // pFq series, Luke's rational and Pade approximations of 1F1, the
+  // recurrence solvers) spell their loops as sequences of those on
+  // long-lived variables when inplace_arithmetic<T> holds.
+  //
+  // It holds for the number-like class types, those with a specialized
+  // std::numeric_limits, and never for the built-in types, where the
+  // compiler removes the temporaries anyway and the expressions keep their
+  // rounding. It is switched off globally by defining
+  // BOOST_MATH_NO_INPLACE_ARITHMETIC, or per type by specializing it.
+
+  namespace boost { namespace math { namespace tools {
+
+  template <class T>
+  struct inplace_arithmetic: boost::mpl::bool_<
+#ifndef BOOST_MATH_NO_INPLACE_ARITHMETIC
+        std::numeric_limits<T>::is_specialized &&
+        !std::numeric_limits<T>::is_integer &&
+        !boost::is_floating_point<T>::value
+#else
+        false
+#endif
+        > {};
+
+  // x = |x| without a temporary; zero is a T holding 0
+  template <class T>
+  inline void inplace_fabs(T& x, const T& zero)
+  {
+    if (x < zero)
+      x = -x;
+  }
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_TOOLS_INPLACE_ARITHMETIC_HPP_
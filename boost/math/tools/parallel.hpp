@@ -0,0 +1,148 @@
+//  (C) Copyright Anton Bikineev 2014
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_PARALLEL_HPP_
+  #define BOOST_MATH_TOOLS_PARALLEL_HPP_
+
+  #include <cstddef>
+  #include <vector>
+
+  #include <boost/math/tools/config.hpp>
+
+  #ifndef BOOST_NO_CXX11_HDR_THREAD
+    #include <exception>
+    #include <thread>
+  #endif
+
+  // Minimal fork-join helper used by the batch and grid evaluation
+  // routines. Work is split into contiguous chunks, one per thread,
+  // so that every thread writes to its own part of an output buffer.
+  // Without <thread> support everything runs on the calling thread.
+
+  namespace boost { namespace math { namespace tools {
+
+  // number of threads to use when the caller passes zero
+  inline unsigned default_thread_count()
+  {
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+    const unsigned n = std::thread::hardware_concurrency();
+    return n ? n : 1u;
+#else
+    return 1u;
+#endif
+  }
+
+  namespace detail {
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+  template <class Functor>
+  struct parallel_chunk_task
+  {
+    parallel_chunk_task(Functor& f, std::size_t first, std::size_t last, std::exception_ptr& error):
+      f(f), first(first), last(last), error(error)
+    {
+    }
+
+    void operator()() const
+    {
+      try
+      {
+        f(first, last);
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+    }
+
+  private:
+    Functor& f;
+    const std::size_t first, last;
+    std::exception_ptr& error;
+  };
+
+  // joins the threads started so far however the scope is left: should
+  // starting a thread throw, the ones already running must not be left
+  // joinable, or their destructors would call std::terminate
+  struct parallel_thread_joiner
+  {
+    explicit parallel_thread_joiner(std::vector<std::thread>& pool): pool(pool)
+    {
+    }
+
+    ~parallel_thread_joiner()
+    {
+      for (std::size_t t = 0; t < pool.size(); ++t)
+        if (pool[t].joinable())
+          pool[t].join();
+    }
+
+  private:
+    parallel_thread_joiner(const parallel_thread_joiner&);
+    parallel_thread_joiner& operator=(const parallel_thread_joiner&);
+
+    std::vector<std::thread>& pool;
+  };
+#endif
+
+  } // namespace detail
+
+  // calls f(first, last) for contiguous chunks covering [0, count);
+  // the functor must be safe to call concurrently on disjoint chunks.
+  // The first exception thrown by any chunk is rethrown to the caller
+  // after all threads have joined; so is a failure to start a thread,
+  // once the threads already started have finished their chunks.
+  template <class Functor>
+  inline void parallel_for_chunks(std::size_t count, unsigned threads, Functor& f)
+  {
+    if (threads == 0)
+      threads = tools::default_thread_count();
+    if (threads > count)
+      threads = static_cast<unsigned>(count);
+
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+    if (threads > 1)
+    {
+      std::vector<std::exception_ptr> errors(threads);
+      std::vector<std::thread> pool;
+      pool.reserve(threads - 1);
+
+      const std::size_t chunk = count / threads;
+      const std::size_t remainder = count % threads;
+
+      {
+        detail::parallel_thread_joiner joiner(pool);
+
+        std::size_t first = 0;
+        for (unsigned t = 0; t < threads; ++t)
+        {
+          const std::size_t last = first + chunk + (t < remainder ? 1 : 0);
+          detail::parallel_chunk_task<Functor> task(f, first, last, errors[t]);
+
+          // the calling thread takes the last chunk itself
+          if (t + 1 < threads)
+            pool.push_back(std::thread(task));
+          else
+            task();
+
+          first = last;
+        }
+      }
+
+      for (std::size_t t = 0; t < errors.size(); ++t)
+        if (errors[t])
+          std::rethrow_exception(errors[t]);
+
+      return;
+    }
+#endif
+
+    if (count)
+      f(std::size_t(0), count);
+  }
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_TOOLS_PARALLEL_HPP_
@@ -9,11 +9,16 @@
   #include <vector>
   #include <algorithm>
   #include <functional>
+  #include <limits>
 
+  #include <boost/cstdint.hpp>
   #include <boost/mpl/bool.hpp>
   #include <boost/bind.hpp>
+  #include <boost/static_assert.hpp>
 
   #include <boost/math/tools/config.hpp>
+  #include <boost/math/tools/inplace_arithmetic.hpp>
+  #include <boost/math/tools/parallel.hpp>
   #include <boost/math/tools/precision.hpp>
   #include <boost/math/tools/tuple.hpp>
   #include <boost/math/special_functions/next.hpp>
@@ -32,13 +37,103 @@
   struct is_homogeneous: boost::mpl::bool_<
         boost::math::tuple_size<typename T::result_type>::value == 3u>::type {};
 
-  // solves recurrence relation defined by homogeneous difference equation
-  // a(n)w(n+1) - b(n)w(n) + c(n)w(n-1) = 0
-  template <class Functor, class U, class T>
-  inline std::pair<T, unsigned> olver_checked_recurrence_imp(Functor& get_coefs, const U& factor, const T& init_value, unsigned init_pos, unsigned index, boost::mpl::true_)
+  // Olver's method for a(n)w(n+1) - b(n)w(n) + c(n)w(n-1) = d(n), with d(n) = 0
+  // in the homogeneous case, runs the recurrences
+  //   a(n)p(n+1) = b(n)p(n) - c(n)p(n-1) + d(n),  p(0) = 0, p(1) = 1,
+  //   a(n)e(n) = c(n)e(n-1) - d(n)p(n+1),          e(0) = w(0),
+  // forward until the estimate |e(n-1) / (p(n-1)p(n))| of the truncation error
+  // is small enough, then w(n-1) = (p(n-1)w(n) + e(n-1)) / p(n) backward from
+  // w = 0 at the end.
+
+  // e(1) from e(0) = w(0), with coefs the coefficients at 1
+  template <class Coefs, class T>
+  inline T olver_initial_error(const Coefs& coefs, const T& init_value, boost::mpl::true_)
   {
-    BOOST_MATH_STD_USING // fabs
     using boost::math::get;
+    return (get<2>(coefs) * init_value) / get<0>(coefs);
+  }
+
+  template <class Coefs, class T>
+  inline T olver_initial_error(const Coefs& coefs, const T& init_value, boost::mpl::false_)
+  {
+    using boost::math::get;
+    return ((get<2>(coefs) * init_value) - get<3>(coefs)) / get<0>(coefs);
+  }
+
+  // p(i) and e(i) from p(i-2), p(i-1) and e(i-1), with coefs the coefficients
+  // at i - 1 on entry and at i, fetched from position pos, on exit
+  template <class Functor, class T>
+  inline void olver_forward_step(Functor& get_coefs, unsigned pos, typename Functor::result_type& coefs,
+                                 const T& p2, const T& p1, const T& e1, T& p, T& e, boost::mpl::true_)
+  {
+    using boost::math::get;
+
+    p = ((get<1>(coefs) * p1) - (get<2>(coefs) * p2)) / get<0>(coefs);
+    coefs = get_coefs(pos);
+    e = (get<2>(coefs) * e1) / get<0>(coefs);
+  }
+
+  template <class Functor, class T>
+  inline void olver_forward_step(Functor& get_coefs, unsigned pos, typename Functor::result_type& coefs,
+                                 const T& p2, const T& p1, const T& e1, T& p, T& e, boost::mpl::false_)
+  {
+    using boost::math::get;
+
+    p = ((get<1>(coefs) * p1) - (get<2>(coefs) * p2) + get<3>(coefs)) / get<0>(coefs);
+    coefs = get_coefs(pos);
+    e = ((get<2>(coefs) * e1) - (get<3>(coefs) * p)) / get<0>(coefs);
+  }
+
+  // whether the step that produced p(i) and e(i), with coefs now at i,
+  // comes close to overflow
+  template <class Coefs, class T>
+  inline bool olver_near_overflow(const Coefs& coefs, const T& p2, const T& p1, const T& e1, const T&, boost::mpl::true_)
+  {
+    BOOST_MATH_STD_USING // fabs, log
+    using boost::math::get;
+
+    const T an = get<0>(coefs),
+            bn = get<1>(coefs),
+            cn = get<2>(coefs);
+
+    // TODO: this check takes quite long time
+    return log(fabs((bn * p1) - (cn * p2))) >= log(boost::math::tools::max_value<T>()) + log(fabs(an)) ||
+           log(fabs(cn)) + log(fabs(e1)) >= log(boost::math::tools::max_value<T>()) + log(fabs(an));
+  }
+
+  template <class Coefs, class T>
+  inline bool olver_near_overflow(const Coefs& coefs, const T& p2, const T& p1, const T& e1, const T& p, boost::mpl::false_)
+  {
+    BOOST_MATH_STD_USING // fabs, log
+    using boost::math::get;
+
+    const T an = get<0>(coefs),
+            bn = get<1>(coefs),
+            cn = get<2>(coefs),
+            dn = get<3>(coefs);
+
+    // TODO: this check takes quite long time
+    return log(fabs((bn * p1) - (cn * p2) + dn)) >= log(boost::math::tools::max_value<T>()) + log(fabs(an)) ||
+           log(fabs((cn * e1) - (dn * p))) >= log(boost::math::tools::max_value<T>()) + log(fabs(an));
+  }
+
+  // |e(i-1) / (p(i-1)p(i))|, divided in turn: the product of the p(i)
+  // overflows long before either does
+  template <class T>
+  inline T olver_check(const T& p1, const T& p, const T& e1)
+  {
+    BOOST_MATH_STD_USING // fabs
+    return fabs((e1 / p1) / p);
+  }
+
+  // solves the recurrence from position init_pos, where w = init_value, to
+  // init_pos + index, keeping every step of the forward pass; where that pass
+  // comes close to overflow, it stops at the first step whose error estimate
+  // is within factor of the last one, and returns w there with its index
+  template <class Functor, class U, class T, class IsHomogeneous>
+  inline std::pair<T, unsigned> olver_checked_recurrence_imp(Functor& get_coefs, const U& factor, const T& init_value, unsigned init_pos, unsigned index, const IsHomogeneous& is_homogeneous, boost::mpl::false_)
+  {
+    BOOST_MATH_STD_USING // fabs
     typedef typename Functor::result_type coef_tuple;
 
     std::vector<T> p, e, check_ns;
@@ -46,12 +141,9 @@
 
     // initialization
     coef_tuple coefs = get_coefs(init_pos + 1);
-    T an = get<0>(coefs),
-      bn = get<1>(coefs),
-      cn = get<2>(coefs);
 
     p.push_back(0); p.push_back(1);
-    e.push_back(init_value); e.push_back((cn * init_value) / an);
+    e.push_back(init_value); e.push_back(detail::olver_initial_error(coefs, init_value, is_homogeneous));
 
     T check_n = 0;
     T min_check_n = boost::math::tools::max_value<T>();
@@ -59,17 +151,11 @@
 
     // forward recurrence
     do {
-      const T next_p = ((bn * p[i-1]) - (cn * p[i-2])) / an;
-
-      coefs = get_coefs(init_pos + i);
-      an = get<0>(coefs);
-      bn = get<1>(coefs);
-      cn = get<2>(coefs);
+      T next_p, next_e;
 
-      const T next_e = (cn * e[i-1]) / an;
+      detail::olver_forward_step(get_coefs, init_pos + i, coefs, p[i-2], p[i-1], e[i-1], next_p, next_e, is_homogeneous);
 
-      if (log(fabs((bn * p[i-1]) - (cn * p[i-2]))) >= log(boost::math::tools::max_value<T>()) + log(fabs(an)) ||
-          log(fabs(cn)) + log(fabs(e[i-1])) >= log(boost::math::tools::max_value<T>()) + log(fabs(an)) ) // TODO: this check takes quite long time
+      if (detail::olver_near_overflow(coefs, p[i-2], p[i-1], e[i-1], next_p, is_homogeneous))
       {
         typename std::vector<T>::iterator min_check_it =
             std::find_if(check_ns.begin(), check_ns.end(), boost::bind(std::less<T>(), _1, check_ns.back() / factor)); // TODO: find better algorithm with no boost::bind
@@ -80,7 +166,7 @@
 
       p.push_back(next_p); e.push_back(next_e);
 
-      check_n = fabs(e[i-1] / (p[i-1] * p[i]));
+      check_n = detail::olver_check(p[i-1], p[i], e[i-1]);
       if ((i <= index) && (check_n < min_check_n))
         min_check_n = check_n;
 
@@ -102,88 +188,154 @@
     return std::make_pair(w[index], index);
   }
 
-  // solves recurrence relation defined by homogeneous difference equation
-  // a(n)w(n+1) - b(n)w(n) + c(n)w(n-1) = d(n)
-  template <class Functor, class U, class T>
-  inline std::pair<T, unsigned> olver_checked_recurrence_imp(Functor& get_coefs, const U& factor, const T& init_value, unsigned init_pos, unsigned index, boost::mpl::false_)
+  // p(j), p(j+1), e(j) and e(j+1), from which the forward pass of Olver's
+  // method restarts at step j + 2
+  template <class T>
+  struct olver_checkpoint
   {
-    BOOST_MATH_STD_USING // fabs
-    using boost::math::get;
+    olver_checkpoint(const T& p0, const T& p1, const T& e0, const T& e1): p0(p0), p1(p1), e0(e0), e1(e1)
+    {
+    }
+
+    T p0, p1, e0, e1;
+  };
+
+  // p(first + k) and e(first + k) for k < count >= 2 from the checkpoint at first
+  template <class Functor, class T, class IsHomogeneous>
+  inline void olver_regenerate(Functor& get_coefs, unsigned init_pos, unsigned first, unsigned count, const olver_checkpoint<T>& checkpoint, T* p, T* e, const IsHomogeneous& is_homogeneous)
+  {
+    typename Functor::result_type coefs = get_coefs(init_pos + first + 1);
+
+    p[0] = checkpoint.p0; p[1] = checkpoint.p1;
+    e[0] = checkpoint.e0; e[1] = checkpoint.e1;
+
+    for (unsigned k = 2; k < count; ++k)
+      detail::olver_forward_step(get_coefs, init_pos + first + k, coefs, p[k-2], p[k-1], e[k-1], p[k], e[k], is_homogeneous);
+  }
+
+  // the same keeping only p and e at every interval-th step, interval about
+  // sqrt(index): the backward pass, and the search for the restart after an
+  // overflow, regenerate the steps between two checkpoints from the first of
+  // them, so storage drops from O(index) to O(sqrt(index)) for about twice
+  // the work; the steps are the same and so is the result
+  template <class Functor, class U, class T, class IsHomogeneous>
+  inline std::pair<T, unsigned> olver_checked_recurrence_imp(Functor& get_coefs, const U& factor, const T& init_value, unsigned init_pos, unsigned index, const IsHomogeneous& is_homogeneous, boost::mpl::true_)
+  {
+    BOOST_MATH_STD_USING // fabs, sqrt
     typedef typename Functor::result_type coef_tuple;
 
-    std::vector<T> p, e, check_ns;
-    p.reserve(index); e.reserve(index); check_ns.reserve(index);
+    const unsigned interval = (std::max)(2u, static_cast<unsigned>(sqrt(static_cast<double>(index))));
 
     // initialization
     coef_tuple coefs = get_coefs(init_pos + 1);
-    T an = get<0>(coefs),
-      bn = get<1>(coefs),
-      cn = get<2>(coefs),
-      dn = get<3>(coefs);
 
-    p.push_back(0); p.push_back(1);
-    e.push_back(init_value); e.push_back(((cn * init_value) - dn) / an);
+    T p2 = 0, p1 = 1;
+    T e2 = init_value, e1 = detail::olver_initial_error(coefs, init_value, is_homogeneous);
+
+    std::vector<olver_checkpoint<T> > checkpoints;
+    checkpoints.push_back(olver_checkpoint<T>(p2, p1, e2, e1));
 
     T check_n = 0;
     T min_check_n = boost::math::tools::max_value<T>();
+    bool overflow = false;
     unsigned i = 2;
 
     // forward recurrence
     do {
-      const T next_p = ((bn * p[i-1]) - (cn * p[i-2]) + dn) / an;
+      T next_p, next_e;
 
-      coefs = get_coefs(init_pos + i);
-      an = get<0>(coefs);
-      bn = get<1>(coefs);
-      cn = get<2>(coefs);
-      dn = get<3>(coefs);
+      detail::olver_forward_step(get_coefs, init_pos + i, coefs, p2, p1, e1, next_p, next_e, is_homogeneous);
 
-      const T next_e = ((cn * e[i-1]) - (dn * next_p)) / an;
-
-      if (log(fabs((bn * p[i-1]) - (cn * p[i-2]) + dn)) >= log(boost::math::tools::max_value<T>()) + log(fabs(an)) ||
-          log(fabs((cn * e[i-1]) - (dn * next_p))) >= log(boost::math::tools::max_value<T>()) + log(fabs(an)) ) // TODO: this check takes quite long time
+      if (detail::olver_near_overflow(coefs, p2, p1, e1, next_p, is_homogeneous))
       {
-        typename std::vector<T>::iterator min_check_it =
-            std::find_if(check_ns.begin(), check_ns.end(), boost::bind(std::less<T>(), _1, check_ns.back() / factor)); // TODO: find better algorithm with no boost::bind
-        index = std::distance(check_ns.begin(), min_check_it);
-
+        overflow = true;
         break;
       }
 
-      p.push_back(next_p); e.push_back(next_e);
-
-      check_n = fabs(e[i-1] / (p[i-1] * p[i]));
+      check_n = detail::olver_check(p1, next_p, e1);
       if ((i <= index) && (check_n < min_check_n))
         min_check_n = check_n;
 
-      check_ns.push_back(check_n);
+      p2 = p1; p1 = next_p;
+      e2 = e1; e1 = next_e;
+
+      // p(i-1) opens a segment
+      if ((i - 1) % interval == 0)
+        checkpoints.push_back(olver_checkpoint<T>(p2, p1, e2, e1));
 
       ++i;
     } while (check_n > fabs(factor * min_check_n));
 
-    std::vector<T> w;
-    w.resize(p.size());
+    // p and e are known up to i - 1
+    const unsigned size = i;
+    std::vector<T> p(interval + 2u), e(interval + 2u);
 
-    unsigned k = w.size();
-    w[--k] = 0;
+    if (overflow)
+    {
+      // the first step k whose estimate |e(k+1) / (p(k+1)p(k+2))| is below
+      // the last one over factor, or the end where there is none
+      const T limit = check_n / factor;
+      index = size - 2u;
 
-    // backward recurrence
-    for (; k >= index; --k)
-      w[k-1] = (p[k-1] * w[k] + e[k-1]) / p[k];
+      for (unsigned first = 0; first + 2u < size; first += interval)
+      {
+        const unsigned last = (std::min)(first + interval, size - 2u);
+        detail::olver_regenerate(get_coefs, init_pos, first, last - first + 2u, checkpoints[first / interval], &p[0], &e[0], is_homogeneous);
+
+        unsigned k = first;
+        while ((k < last) && !(detail::olver_check(p[k+1-first], p[k+2-first], e[k+1-first]) < limit))
+          ++k;
+
+        if (k < last)
+        {
+          index = k;
+          break;
+        }
+      }
+    }
 
-    return std::make_pair(w[index], index);
+    // backward recurrence, w(k - 1) from w(k) segment by segment from the end
+    T w = 0;
+    unsigned k = size - 1u;
+    while (k > index)
+    {
+      const unsigned first = ((k - 1u) / interval) * interval;
+      detail::olver_regenerate(get_coefs, init_pos, first, k - first + 1u, checkpoints[first / interval], &p[0], &e[0], is_homogeneous);
+
+      for (; (k > first) && (k > index); --k)
+        w = (p[k-1-first] * w + e[k-1-first]) / p[k-first];
+    }
+
+    return std::make_pair(w, index);
   }
 
-  // this wrapper-implementation protects us from possible overflow
-  template <class Functor, class U, class T, class IsHomogeneous>
-  inline T solve_recurrence_relation_by_olver_imp(Functor& get_coefs, const U& factor, unsigned index, T init_value, const IsHomogeneous& is_homogeneous)
+  // w = ((b * x) - (c * y)) / a, the step of the stable recurrences
+  template <class T>
+  inline void recurrence_step(T& w, const T& a, const T& b, const T& c, const T& x, const T& y, T&, boost::mpl::false_)
+  {
+    w = ((b * x) - (c * y)) / a;
+  }
+
+  // the same in place for tools::inplace_arithmetic types
+  template <class T>
+  inline void recurrence_step(T& w, const T& a, const T& b, const T& c, const T& x, const T& y, T& scratch, boost::mpl::true_)
+  {
+    w = x; w *= b;
+    scratch = y; scratch *= c;
+    w -= scratch; w /= a;
+  }
+
+  // this wrapper-implementation protects us from possible overflow;
+  // Checkpointed selects the storage of the forward passes
+  template <class Functor, class U, class T, class IsHomogeneous, class Checkpointed>
+  inline T solve_recurrence_relation_by_olver_imp(Functor& get_coefs, const U& factor, unsigned index, T init_value, const IsHomogeneous& is_homogeneous, const Checkpointed& checkpointed)
   {
     unsigned init_pos = 0u;
     unsigned new_index = index;
 
     do
     {
-      std::pair<T, unsigned> result = detail::olver_checked_recurrence_imp(get_coefs, factor, init_value, init_pos, new_index, is_homogeneous);
+      std::pair<T, unsigned> result = detail::olver_checked_recurrence_imp(get_coefs, factor, init_value, init_pos, new_index, is_homogeneous, checkpointed);
 
       init_pos += result.second;
       new_index -= result.second;
@@ -206,21 +358,25 @@
   // last_index: index N to be found;
   // first: w(0);
   // second: w(1);
+  // previous: if not null, receives w(N-1) (left untouched when N is zero);
   //
   template <class T, class NextCoefs>
-  inline T solve_recurrence_relation_forward(NextCoefs& get_coefs, unsigned last_index, T first, T second)
+  inline T solve_recurrence_relation_forward(NextCoefs& get_coefs, unsigned last_index, T first, T second, T* previous = 0)
   {
     using std::swap;
     using boost::math::tuple;
     using boost::math::get;
 
-    T third = 0;
+    T third = 0, scratch = 0;
 
     for (unsigned k = 0; k < last_index; ++k)
     {
       tuple<T, T, T> next = get_coefs(k);
 
-      third = ((get<1>(next) * second) - (get<2>(next) * first)) / get<0>(next);
+      detail::recurrence_step(third, get<0>(next), get<1>(next), get<2>(next), second, first, scratch, typename inplace_arithmetic<T>::type());
+
+      if (previous)
+        *previous = first;
 
       swap(first, second);
       swap(second, third);
@@ -239,21 +395,25 @@
   // last_index: index N to be found;
   // first: w(0);
   // second: w(1);
+  // previous: if not null, receives w(N-1) (left untouched when N is zero);
   //
   template <class T, class NextCoefs>
-  inline T solve_recurrence_relation_backward(NextCoefs& get_coefs, unsigned last_index, T first, T second)
+  inline T solve_recurrence_relation_backward(NextCoefs& get_coefs, unsigned last_index, T first, T second, T* previous = 0)
   {
     using std::swap;
     using boost::math::tuple;
     using boost::math::get;
 
-    T third = 0;
+    T third = 0, scratch = 0;
 
     for (unsigned k = 0; k < last_index; ++k)
     {
       tuple<T, T, T> next = get_coefs(-static_cast<int>(k));
 
-      third = ((get<1>(next) * second) - (get<0>(next) * first)) / get<2>(next);
+      detail::recurrence_step(third, get<2>(next), get<1>(next), get<0>(next), second, first, scratch, typename inplace_arithmetic<T>::type());
+
+      if (previous)
+        *previous = first;
 
       swap(first, second);
       swap(second, third);
@@ -262,6 +422,204 @@
     return first;
   }
 
+  namespace detail {
+
+  // the recurrence of v(k) = w(-k), indexed as solve_recurrence_relation_forward
+  // wants it when the original is indexed for solve_recurrence_relation_backward
+  template <class Coefficients>
+  struct reversed_recurrence_coefficients
+  {
+    typedef typename Coefficients::result_type result_type;
+
+    explicit reversed_recurrence_coefficients(Coefficients& coefs): coefs(coefs)
+    {
+    }
+
+    result_type operator()(boost::intmax_t k) const
+    {
+      using boost::math::get;
+      const result_type r = coefs(-k);
+      return result_type(get<2>(r), get<1>(r), get<0>(r));
+    }
+
+  private:
+    Coefficients& coefs;
+  };
+
+  // scales v[0..n) by the power of two that brings the largest |v[i]| into
+  // [1/2, 1), and adds that power to exponent
+  template <class T>
+  inline void recurrence_renormalize(T* v, unsigned n, long& exponent)
+  {
+    BOOST_MATH_STD_USING // fabs, frexp, ldexp
+
+    T largest = 0;
+    for (unsigned i = 0; i < n; ++i)
+      largest = (std::max)(largest, T(fabs(v[i])));
+
+    if ((largest == 0) || !(boost::math::isfinite)(largest))
+      return;
+
+    int e;
+    frexp(largest, &e);
+    for (unsigned i = 0; i < n; ++i)
+      v[i] = ldexp(v[i], -e);
+
+    exponent += e;
+  }
+
+  // the product of the step matrices over a block of steps, divided by
+  // 2^exponent: the columns (m00, m10) and (m01, m11) are the solutions from
+  // (w(k), w(k+1)) = (1, 0) and (0, 1) at its first step k
+  template <class T>
+  struct recurrence_block_product
+  {
+    T m00, m01, m10, m11;
+    long exponent;
+  };
+
+  // multiplies out the blocks [first, last) of the steps of the forward
+  // recurrence, block j covering the steps [j steps / blocks, (j + 1) steps / blocks)
+  template <class Coefficients, class T>
+  struct recurrence_block_task
+  {
+    recurrence_block_task(Coefficients& get_coefs, unsigned steps, unsigned blocks, std::vector<recurrence_block_product<T> >& products):
+      get_coefs(get_coefs), steps(steps), blocks(blocks), products(products)
+    {
+    }
+
+    void operator()(std::size_t first, std::size_t last)
+    {
+      for (std::size_t j = first; j < last; ++j)
+        products[j] = product(boundary(j), boundary(j + 1u));
+    }
+
+  private:
+    unsigned boundary(std::size_t j) const
+    {
+      return static_cast<unsigned>((static_cast<boost::uintmax_t>(j) * steps) / blocks);
+    }
+
+    recurrence_block_product<T> product(unsigned begin, unsigned end)
+    {
+      BOOST_MATH_STD_USING // fabs, sqrt
+      using std::swap;
+      using boost::math::tuple;
+      using boost::math::get;
+
+      // the two solutions stepped side by side, (w(k), w(k+1)) in v[0], v[1]
+      // and v[2], v[3]; they are scaled back where they leave the middle of
+      // the exponent range
+      const T upper = sqrt(boost::math::tools::max_value<T>());
+      const T lower = 1 / upper;
+
+      T v[4] = { 1, 0, 0, 1 };
+      T third = 0, scratch = 0;
+      long exponent = 0;
+
+      for (unsigned k = begin; k < end; ++k)
+      {
+        tuple<T, T, T> next = get_coefs(k);
+
+        detail::recurrence_step(third, get<0>(next), get<1>(next), get<2>(next), v[1], v[0], scratch, typename inplace_arithmetic<T>::type());
+        swap(v[0], v[1]);
+        swap(v[1], third);
+
+        detail::recurrence_step(third, get<0>(next), get<1>(next), get<2>(next), v[3], v[2], scratch, typename inplace_arithmetic<T>::type());
+        swap(v[2], v[3]);
+        swap(v[3], third);
+
+        const T size = fabs(v[1]) + fabs(v[3]);
+        if (!((size < upper) && (size > lower)))
+          detail::recurrence_renormalize(v, 4u, exponent);
+      }
+
+      recurrence_block_product<T> result;
+      result.m00 = v[0]; result.m10 = v[1];
+      result.m01 = v[2]; result.m11 = v[3];
+      result.exponent = exponent;
+
+      return result;
+    }
+
+    Coefficients& get_coefs;
+    const unsigned steps, blocks;
+    std::vector<recurrence_block_product<T> >& products;
+  };
+
+  // steps a block needs for the parallel solution to pay off
+  inline unsigned recurrence_parallel_block_length()
+  {
+    return 4096u;
+  }
+
+  // the N - 1 steps from (w(0), w(1)) to (w(N-1), w(N)) as products of blocks
+  // of step matrices formed in parallel, then applied to (w(0), w(1)) in turn
+  template <class T, class NextCoefs>
+  inline T solve_recurrence_relation_in_blocks(NextCoefs& get_coefs, unsigned last_index, T first, T second, unsigned threads, T* previous)
+  {
+    BOOST_MATH_STD_USING // ldexp
+
+    if (threads == 0)
+      threads = tools::default_thread_count();
+
+    const unsigned steps = last_index ? last_index - 1u : 0u;
+    const unsigned blocks = (std::min)(threads, steps / detail::recurrence_parallel_block_length());
+
+    if (blocks < 2u)
+      return tools::solve_recurrence_relation_forward(get_coefs, last_index, first, second, previous);
+
+    std::vector<recurrence_block_product<T> > products(blocks);
+    detail::recurrence_block_task<NextCoefs, T> task(get_coefs, steps, blocks, products);
+    tools::parallel_for_chunks(blocks, threads, task);
+
+    // the scan: (w(k), w(k+1)) at the end of every block, times 2^-exponent
+    T v[2] = { first, second };
+    long exponent = 0;
+    for (unsigned j = 0; j < blocks; ++j)
+    {
+      const recurrence_block_product<T>& m = products[j];
+      const T x = (m.m00 * v[0]) + (m.m01 * v[1]);
+      const T y = (m.m10 * v[0]) + (m.m11 * v[1]);
+
+      v[0] = x;
+      v[1] = y;
+      exponent += m.exponent;
+      detail::recurrence_renormalize(v, 2u, exponent);
+    }
+
+    // past the range of int the result is out of that of T anyway
+    const int e = static_cast<int>((std::max)((std::min)(exponent, long((std::numeric_limits<int>::max)() / 2)), long((std::numeric_limits<int>::min)() / 2)));
+
+    if (previous)
+      *previous = ldexp(v[0], e);
+
+    return ldexp(v[1], e);
+  }
+
+  } // namespace detail
+
+  // solve_recurrence_relation_forward split between threads (threads == 0
+  // means hardware concurrency). The steps are products with 2x2 matrices,
+  // which are associative: blocks of them are multiplied out in parallel,
+  // scaled by powers of two against overflow, and applied to (w(0), w(1))
+  // in turn. A block steps two solutions, so this pays off from a few
+  // thousand steps a thread; shorter recurrences are solved on the calling
+  // thread. get_coefs must be safe to call concurrently.
+  template <class T, class NextCoefs>
+  inline T solve_recurrence_relation_forward_parallel(NextCoefs& get_coefs, unsigned last_index, T first, T second, unsigned threads = 0u, T* previous = 0)
+  {
+    return detail::solve_recurrence_relation_in_blocks(get_coefs, last_index, first, second, threads, previous);
+  }
+
+  // solve_recurrence_relation_backward split between threads in the same way
+  template <class T, class NextCoefs>
+  inline T solve_recurrence_relation_backward_parallel(NextCoefs& get_coefs, unsigned last_index, T first, T second, unsigned threads = 0u, T* previous = 0)
+  {
+    detail::reversed_recurrence_coefficients<NextCoefs> reversed(get_coefs);
+    return detail::solve_recurrence_relation_in_blocks(reversed, last_index, first, second, threads, previous);
+  }
+
   // solves difference equations of the following form in unstable directions:
   // a(n)w(n+1) - b(n)w(n) + c(n)w(n-1) = d(n) - inhomogeneous case
   // a(n)w(n+1) - b(n)w(n) + c(n)w(n-1) = 0    - homogeneous case
@@ -273,7 +631,630 @@
   {
     typedef typename detail::is_homogeneous<Coefficients>::type is_homogeneous;
 
-    return detail::solve_recurrence_relation_by_olver_imp(coefs, factor, index, init_value, is_homogeneous());
+    return detail::solve_recurrence_relation_by_olver_imp(coefs, factor, index, init_value, is_homogeneous(), boost::mpl::false_());
+  }
+
+  // the same in O(sqrt(index)) storage instead of O(index), for about twice
+  // the work: the forward pass keeps only checkpoints, and the backward pass
+  // regenerates the steps between them. For very long recurrences in
+  // multiprecision types, where the forward pass does not overflow and so
+  // runs the whole length at once, the storage of every step would take
+  // gigabytes; the result is the same.
+  template <class Coefficients, class U, class T>
+  inline T solve_recurrence_relation_by_olver_checkpointed(Coefficients& coefs, const U& factor, unsigned index, const T& init_value)
+  {
+    typedef typename detail::is_homogeneous<Coefficients>::type is_homogeneous;
+
+    return detail::solve_recurrence_relation_by_olver_imp(coefs, factor, index, init_value, is_homogeneous(), boost::mpl::true_());
+  }
+
+  // normalizations for solve_recurrence_relation_by_miller, which picks the
+  // solution with sum(n >= 0) weight(n) * w(n) == sum(); a normalization
+  // is any class with value_type, T operator()(boost::uintmax_t n) const
+  // giving weight(n) and T sum() const. Known sums make cheap ones, such
+  // as J0(x) + 2 J2(x) + 2 J4(x) + ... == 1 or I0(x) + 2 I1(x) + ... == exp(x);
+  // this one is a known value w(index), index no larger than the last index
+  template <class T>
+  struct recurrence_value_normalization
+  {
+    typedef T value_type;
+
+    recurrence_value_normalization(const T& value, boost::uintmax_t index = 0u): value(value), index(index)
+    {
+    }
+
+    T operator()(boost::uintmax_t n) const { return (n == index) ? T(1) : T(0); }
+    T sum() const { return value; }
+
+  private:
+    const T value;
+    const boost::uintmax_t index;
+  };
+
+  namespace detail {
+
+  // where Miller's algorithm starts to reach w(last_index) to working
+  // precision: the index at which the solution with w(last_index) == 0 and
+  // w(last_index + 1) == 1, which grows as the dominant solution does over
+  // the minimal one, passes 1 / epsilon; at most max_terms steps beyond
+  // last_index, max_terms receives the number taken
+  template <class T, class Coefficients>
+  inline boost::uintmax_t miller_start_index(Coefficients& get_coefs, boost::uintmax_t last_index, boost::uintmax_t& max_terms)
+  {
+    BOOST_MATH_STD_USING
+    using boost::math::get;
+    typedef typename Coefficients::result_type coef_tuple;
+
+    const T limit = 1 / boost::math::tools::epsilon<T>();
+
+    T previous = 0, current = 1, next = 0, scratch = 0;
+    boost::uintmax_t steps = 1u;
+
+    // current is w(last_index + steps), the relation at n is get_coefs(n - 1)
+    while ((fabs(current) < limit) && (steps < max_terms))
+    {
+      const coef_tuple coefs = get_coefs(static_cast<boost::intmax_t>(last_index + steps - 1u));
+      detail::recurrence_step(next, get<0>(coefs), get<1>(coefs), get<2>(coefs), current, previous, scratch, typename inplace_arithmetic<T>::type());
+
+      previous = current;
+      current = next;
+      ++steps;
+    }
+
+    max_terms = steps;
+    return last_index + steps;
+  }
+
+  // the backward pass of Miller's algorithm from start down to 0: returns
+  // w(last_index) and stores w(0), ..., w(last_index) in range, if not null
+  template <class Coefficients, class Normalization>
+  typename Normalization::value_type miller_recurrence_imp(Coefficients& get_coefs, boost::uintmax_t start, boost::uintmax_t last_index, const Normalization& normalization, std::vector<typename Normalization::value_type>* range)
+  {
+    BOOST_MATH_STD_USING
+    using boost::math::get;
+    typedef typename Normalization::value_type T;
+    typedef typename Coefficients::result_type coef_tuple;
+
+    const T big = sqrt(boost::math::tools::max_value<T>());
+
+    T next = 0, current = 1, previous = 0, scratch = 0;
+    T sum = 0, target = 0;
+
+    if (range)
+      range->assign(static_cast<std::size_t>(last_index + 1u), T(0));
+
+    // current is w(n) of some solution that is all but the minimal one
+    for (boost::uintmax_t n = start; ; --n)
+    {
+      const T weight = normalization(n);
+      if (weight != 0)
+        sum += weight * current;
+
+      if (n == last_index)
+        target = current;
+      if (range && (n <= last_index))
+        (*range)[static_cast<std::size_t>(n)] = current;
+
+      if (n == 0u)
+        break;
+
+      // w(n - 1) = (b(n)w(n) - a(n)w(n + 1)) / c(n)
+      const coef_tuple coefs = get_coefs(static_cast<boost::intmax_t>(n - 1u));
+      detail::recurrence_step(previous, get<2>(coefs), get<1>(coefs), get<0>(coefs), current, next, scratch, typename inplace_arithmetic<T>::type());
+
+      next = current;
+      current = previous;
+
+      if (fabs(current) > big)
+      {
+        current /= big;
+        next /= big;
+        sum /= big;
+        target /= big;
+
+        // the values already stored, rescaled only as often as the solution grows by big
+        if (range)
+          for (std::size_t k = static_cast<std::size_t>(n); k < range->size(); ++k)
+            (*range)[k] /= big;
+      }
+    }
+
+    const T factor = normalization.sum() / sum;
+
+    if (range)
+      for (std::size_t k = 0; k < range->size(); ++k)
+        (*range)[k] *= factor;
+
+    return target * factor;
+  }
+
+  } // namespace detail
+
+  // solves homogeneous difference equation
+  // a(n)w(n+1) - b(n)w(n) + c(n)w(n-1) = 0
+  // for its minimal solution with Miller's algorithm: the recurrence is
+  // run backwards from arbitrary values far enough beyond last_index for
+  // the dominant solution to fade, and the result is scaled to meet the
+  // normalization. Unlike Olver's method it stores nothing on the way out,
+  // and one run gives the whole of w(0), ..., w(last_index).
+  //
+  // Params:
+  // get_coefs: functor returning a tuple, where
+  //            get<0>() is a(n); get<1>() is b(n); get<2>() is c(n);
+  //            indexed as for solve_recurrence_relation_forward;
+  // last_index: index N to be found;
+  // normalization: as recurrence_value_normalization;
+  // out: receives w(0), ..., w(N) in that order;
+  // max_terms: on entry the most steps beyond N the start may be taken,
+  //            on exit the number taken;
+  //
+  // Returns out past the last value written.
+  //
+  template <class Coefficients, class Normalization, class OutputIterator>
+  inline OutputIterator solve_recurrence_relation_by_miller(Coefficients& get_coefs, unsigned last_index, const Normalization& normalization, OutputIterator out, boost::uintmax_t& max_terms)
+  {
+    typedef typename Normalization::value_type T;
+
+    BOOST_STATIC_ASSERT_MSG(detail::is_homogeneous<Coefficients>::value, "Miller's algorithm takes homogeneous recurrences only");
+
+    const boost::uintmax_t start = detail::miller_start_index<T>(get_coefs, last_index, max_terms);
+
+    std::vector<T> range;
+    detail::miller_recurrence_imp(get_coefs, start, last_index, normalization, &range);
+
+    return std::copy(range.begin(), range.end(), out);
+  }
+
+  // the same for w(last_index) alone
+  template <class Coefficients, class Normalization>
+  inline typename Normalization::value_type solve_recurrence_relation_by_miller(Coefficients& get_coefs, unsigned last_index, const Normalization& normalization, boost::uintmax_t& max_terms)
+  {
+    typedef typename Normalization::value_type T;
+
+    BOOST_STATIC_ASSERT_MSG(detail::is_homogeneous<Coefficients>::value, "Miller's algorithm takes homogeneous recurrences only");
+
+    const boost::uintmax_t start = detail::miller_start_index<T>(get_coefs, last_index, max_terms);
+
+    return detail::miller_recurrence_imp(get_coefs, start, last_index, normalization, static_cast<std::vector<T>*>(0));
+  }
+
+  // ways of solving a(n)w(n+1) - b(n)w(n) + c(n)w(n-1) = 0
+  // for the solution given by w(0) and its neighbour
+  enum recurrence_method
+  {
+    recurrence_forward,  // stepping towards larger n
+    recurrence_backward, // stepping towards smaller n
+    recurrence_miller,   // stepping back from beyond the target, normalized by w(0)
+    recurrence_olver     // Olver's boundary value method
+  };
+
+  namespace detail {
+
+  // the coefficients centered on w(n) as Olver's method takes them,
+  // from the ones centered on w(n + 1) of the stepping solvers
+  template <class Coefficients>
+  struct centered_recurrence_coefficients
+  {
+    typedef typename Coefficients::result_type result_type;
+
+    explicit centered_recurrence_coefficients(Coefficients& coefs): coefs(coefs)
+    {
+    }
+
+    result_type operator()(boost::intmax_t n) const
+    {
+      return coefs(n - 1);
+    }
+
+  private:
+    Coefficients& coefs;
+  };
+
+  // the roots t of a t^2 - b t + c = 0, the ratios w(n+1) / w(n) the two
+  // solutions tend to near n, ordered by modulus; complex roots, of equal
+  // modulus, are both returned as that modulus
+  template <class T>
+  inline void recurrence_characteristic_roots(T a, T b, T c, T& small, T& large)
+  {
+    BOOST_MATH_STD_USING
+
+    // keep the discriminant in range
+    const T scale = (std::max)(fabs(a), (std::max)(fabs(b), fabs(c)));
+    if (scale == 0)
+    {
+      small = large = 0;
+      return;
+    }
+    a /= scale; b /= scale; c /= scale;
+
+    if (a == 0)
+    {
+      small = (b == 0) ? T(0) : fabs(c / b);
+      large = boost::math::tools::max_value<T>();
+      return;
+    }
+
+    const T discriminant = (b * b) - (4 * (a * c));
+    if (discriminant < 0)
+    {
+      small = large = sqrt(c / a);
+      return;
+    }
+
+    // q / a and c / q without cancellation
+    const T root = sqrt(discriminant);
+    const T q = (b + ((b < 0) ? T(-root) : root)) / 2;
+    const T t1 = fabs(q / a);
+    const T t2 = (q == 0) ? T(0) : fabs(c / q);
+
+    small = (std::min)(t1, t2);
+    large = (std::max)(t1, t2);
+  }
+
+  // the recurrence from index start on, indexed from 0 again
+  template <class Coefficients>
+  struct shifted_recurrence_coefficients
+  {
+    typedef typename Coefficients::result_type result_type;
+
+    shifted_recurrence_coefficients(Coefficients& coefs, boost::uintmax_t start): coefs(coefs), start(static_cast<boost::intmax_t>(start))
+    {
+    }
+
+    result_type operator()(boost::intmax_t k) const
+    {
+      return coefs(k + start);
+    }
+
+  private:
+    Coefficients& coefs;
+    const boost::intmax_t start;
+  };
+
+  template <class T>
+  struct recurrence_plan
+  {
+    recurrence_method method; // taken if the solution turns out minimal
+    boost::uintmax_t start;   // where that is told: 0, or the first index with the roots apart
+    T amplification;          // of the rounding errors when stepping
+    T small, large;           // the roots at start
+    T ratio;                  // of the roots near the end, small / large
+  };
+
+  // roots closer than this count as together
+  template <class T>
+  inline T recurrence_roots_apart()
+  {
+    return T(1) / 2;
+  }
+
+  // small / large of the roots at n, 0 where one of them is infinite
+  template <class T, class Coefficients>
+  inline T recurrence_roots_ratio(Coefficients& get_coefs, boost::uintmax_t n, T& small, T& large)
+  {
+    using boost::math::get;
+    typedef typename Coefficients::result_type coef_tuple;
+
+    const coef_tuple coefs = get_coefs(static_cast<boost::intmax_t>(n));
+    detail::recurrence_characteristic_roots<T>(get<0>(coefs), get<1>(coefs), get<2>(coefs), small, large);
+
+    if (!(large < boost::math::tools::max_value<T>()))
+      return 0;
+    return (large == 0) ? T(1) : T(small / large);
+  }
+
+  // forward stepping is the choice unless the solution may be the minimal
+  // one and stepping would magnify its rounding errors by more than the
+  // number of steps, estimated from the ratio of the roots at both ends.
+  // Whether it is minimal is told where the roots are apart, as w(1) / w(0)
+  // is the smaller root there for the minimal solution and the larger one
+  // for any other: at the start, or else at the first index with the roots
+  // apart, found by bisection (the solutions oscillate up to a turning
+  // point, say, where the local ratio tells nothing). Miller's method is
+  // planned if the roots near the end are well apart, Olver's if they are
+  // apart again at twice the steps, and forward stepping otherwise.
+  // The plan is only a guess: a solution may start out close to the
+  // minimal one and still not be minimal (the terminating series, say),
+  // see settle_recurrence_plan
+  template <class T, class Coefficients>
+  inline recurrence_plan<T> plan_recurrence_forward(Coefficients& get_coefs, boost::uintmax_t steps, const T& first, const T& second)
+  {
+    BOOST_MATH_STD_USING
+
+    recurrence_plan<T> plan;
+    plan.method = recurrence_forward;
+    plan.start = 0u;
+    plan.amplification = 1;
+    plan.small = plan.large = 0;
+    plan.ratio = 1;
+
+    if ((steps < 2u) || (first == 0))
+      return plan;
+
+    T small_start = 0, large_start = 0, small_end = 0, large_end = 0;
+    const T start_ratio = detail::recurrence_roots_ratio(get_coefs, 0u, small_start, large_start);
+    plan.ratio = detail::recurrence_roots_ratio(get_coefs, steps - 1u, small_end, large_end);
+
+    if ((small_start == 0) || (small_end == 0) || !(large_end < boost::math::tools::max_value<T>()))
+      return plan;
+
+    const T apart = detail::recurrence_roots_apart<T>();
+    const bool start_apart = start_ratio < apart;
+
+    // the roots together at both ends tell nothing
+    if (!start_apart && !(plan.ratio < apart))
+      return plan;
+
+    // dominant from the start
+    const T q = fabs(second / first);
+    if (start_apart && (fabs(q - small_start) >= fabs(q - large_start)))
+      return plan;
+
+    // the minimal solution loses log(large / small) per step to the dominant one
+    const T loss = (log(large_start / small_start) + log(large_end / small_end)) / 2;
+    const T log_amplification = loss * static_cast<T>(steps);
+
+    if (!(log_amplification > log(static_cast<T>(steps))))
+      return plan;
+
+    // Olver's forward pass runs on past the end until the minimal solution
+    // stands out, which it never does while the roots stay together, as
+    // they do from a turning point on for a solution that keeps oscillating
+    if (!(plan.ratio < apart))
+    {
+      T small_beyond = 0, large_beyond = 0;
+      if (!(detail::recurrence_roots_ratio(get_coefs, 2u * steps, small_beyond, large_beyond) < apart))
+        return plan;
+    }
+
+    plan.amplification = (log_amplification < boost::math::tools::log_max_value<T>()) ? T(exp(log_amplification)) : boost::math::tools::max_value<T>();
+    plan.method = (plan.ratio < apart) ? recurrence_miller : recurrence_olver;
+    plan.small = small_start;
+    plan.large = large_start;
+
+    if (start_apart)
+      return plan;
+
+    // the roots are apart at steps - 1 and not at 0
+    boost::uintmax_t together = 0u, apart_at = steps - 1u;
+    while (apart_at - together > 1u)
+    {
+      const boost::uintmax_t middle = together + ((apart_at - together) / 2u);
+      T small = 0, large = 0;
+      if (detail::recurrence_roots_ratio(get_coefs, middle, small, large) < apart)
+        apart_at = middle;
+      else
+        together = middle;
+    }
+
+    plan.start = apart_at;
+    detail::recurrence_roots_ratio(get_coefs, plan.start, plan.small, plan.large);
+    return plan;
+  }
+
+  // Miller's algorithm as solve_recurrence_relation_by_miller, with the start
+  // taken from the ratio of the roots near the end and normalized by w(0);
+  // minimal, if not null, receives w(1) / w(0) of the minimal solution, and
+  // previous w(steps - 1)
+  template <class T, class Coefficients>
+  inline T miller_recurrence_from_ratio(Coefficients& get_coefs, boost::uintmax_t steps, const T& first, const T& ratio, T* minimal = 0, T* previous = 0)
+  {
+    BOOST_MATH_STD_USING
+    using boost::math::get;
+    typedef typename Coefficients::result_type coef_tuple;
+
+    // enough steps for the dominant solution to fade below epsilon
+    const boost::uintmax_t extra = 10u + static_cast<boost::uintmax_t>(
+      ceil(log(boost::math::tools::epsilon<T>()) / log((std::min)(ratio, T(0.99f)))));
+
+    const T big = sqrt(boost::math::tools::max_value<T>());
+
+    T next = 0, current = 1;
+    T target = 0, before_target = 0;
+
+    // current is w(n), w(n - 1) = (b(n)w(n) - a(n)w(n + 1)) / c(n)
+    // with the relation at n in get_coefs(n - 1)
+    for (boost::uintmax_t n = steps + extra; ; --n)
+    {
+      if (n == steps)
+        target = current;
+      if (n + 1u == steps)
+        before_target = current;
+
+      if (n == 0u)
+        break;
+
+      const coef_tuple coefs = get_coefs(static_cast<boost::intmax_t>(n - 1u));
+      const T w = ((get<1>(coefs) * current) - (get<0>(coefs) * next)) / get<2>(coefs);
+
+      next = current;
+      current = w;
+
+      if (fabs(current) > big)
+      {
+        current /= big;
+        next /= big;
+        target /= big;
+        before_target /= big;
+      }
+    }
+
+    if (minimal)
+      *minimal = next / current;
+
+    const T factor = first / current;
+    if (previous)
+      *previous = before_target * factor;
+
+    return target * factor;
+  }
+
+  // Pincherle: the solution is minimal if it starts as the minimal one,
+  // whose w(1) / w(0) is minimal, does; a dominant part of relative size d
+  // at the start ends up as d times the amplification, so d is taken for
+  // the error of the seeds, tolerance, and no larger
+  template <class T>
+  inline bool recurrence_starts_as(const T& minimal, const T& q, const T& tolerance)
+  {
+    BOOST_MATH_STD_USING // fabs
+    return fabs(minimal - q) <= tolerance * fabs(q);
+  }
+
+  // settles the plan for the solution given by first and second, with w0
+  // and w1 its values at the start of the plan: Miller's or Olver's method
+  // stays only if the solution is found minimal there by a short run of
+  // Miller's method, whose length the ratio of the roots at the start sets;
+  // seed_error is the relative error of first and second. Result, if not
+  // null, then receives w(steps) normalized by first, and previous, if not
+  // null, w(steps - 1); the work spent deciding is independent of steps
+  template <class T, class Coefficients>
+  inline recurrence_method settle_recurrence_plan(Coefficients& get_coefs, const recurrence_plan<T>& plan, boost::uintmax_t steps, const T& first, const T& w0, const T& w1, const T& seed_error, T* result, T* previous)
+  {
+    BOOST_MATH_STD_USING // fabs
+
+    if ((plan.method == recurrence_forward) || (w0 == 0))
+      return recurrence_forward;
+
+    // dominant from the start
+    const T q = w1 / w0;
+    if (fabs(fabs(q) - plan.small) >= fabs(fabs(q) - plan.large))
+      return recurrence_forward;
+
+    // both seeds, the rounding of the steps up to the start,
+    // and that of the ratio itself
+    const T tolerance = (2 * seed_error) + (static_cast<T>(plan.start + 64u) * boost::math::tools::epsilon<T>());
+
+    T minimal = 0;
+    shifted_recurrence_coefficients<Coefficients> shifted(get_coefs, plan.start);
+    detail::miller_recurrence_from_ratio(shifted, 1u, w0, T(plan.small / plan.large), &minimal);
+
+    if (!detail::recurrence_starts_as(minimal, q, tolerance))
+      return recurrence_forward;
+
+    if (result && (plan.method == recurrence_miller))
+      *result = detail::miller_recurrence_from_ratio(get_coefs, steps, first, plan.ratio, static_cast<T*>(0), previous);
+
+    // Olver's method is planned for a start at 0 only, as the roots are
+    // apart at the end otherwise; w(steps - 1) takes a second run
+    if (result && (plan.method == recurrence_olver))
+    {
+      centered_recurrence_coefficients<Coefficients> centered(get_coefs);
+      *result = tools::solve_recurrence_relation_by_olver(centered, boost::math::tools::epsilon<T>(), static_cast<unsigned>(steps), first);
+      if (previous)
+        *previous = tools::solve_recurrence_relation_by_olver(centered, boost::math::tools::epsilon<T>(), static_cast<unsigned>(steps - 1u), first);
+    }
+
+    return plan.method;
+  }
+
+  // solve_recurrence_relation for index >= 0, and choose_recurrence_method
+  // when result is null: the steps up to the start of the plan, where the
+  // roots are together, are what telling the solutions apart costs
+  template <class T, class Coefficients>
+  inline recurrence_method solve_recurrence_relation_upward(Coefficients& get_coefs, boost::uintmax_t steps, const T& first, const T& second, const T& seed_error, T* result, T* error, T* previous)
+  {
+    const recurrence_plan<T> plan = detail::plan_recurrence_forward(get_coefs, steps, first, second);
+    const T eps = boost::math::tools::epsilon<T>();
+
+    // w(start) and w(start + 1)
+    T w0 = first, w1 = second;
+    if (plan.start > 0u)
+      w1 = tools::solve_recurrence_relation_forward(get_coefs, static_cast<unsigned>(plan.start + 1u), first, second, &w0);
+
+    const recurrence_method settled = detail::settle_recurrence_plan(get_coefs, plan, steps, first, w0, w1, seed_error, result, previous);
+
+    if (settled != recurrence_forward)
+    {
+      if (error)
+        *error = eps * (steps + 1);
+      return settled;
+    }
+
+    // dominant, or found not to be minimal after all: on from the start
+    if (error)
+      *error = eps * (steps + 1) * plan.amplification;
+    if (result)
+    {
+      shifted_recurrence_coefficients<Coefficients> shifted(get_coefs, plan.start);
+      *result = tools::solve_recurrence_relation_forward(shifted, static_cast<unsigned>(steps - plan.start), w0, w1, previous);
+    }
+
+    return recurrence_forward;
+  }
+
+  } // namespace detail
+
+  // chooses the way solve_recurrence_relation takes for the solution of
+  // a(n)w(n+1) - b(n)w(n) + c(n)w(n-1) = 0 given by first and second;
+  // the parameters are those of solve_recurrence_relation; telling
+  // whether the solution is minimal may take the steps up to the first
+  // index with the roots of the characteristic equation apart, and a
+  // few more of Miller's method
+  template <class T, class Coefficients>
+  inline recurrence_method choose_recurrence_method(Coefficients& get_coefs, boost::intmax_t index, const T& first, const T& second, const T& seed_error = 0)
+  {
+    if (index >= 0)
+      return detail::solve_recurrence_relation_upward(get_coefs, static_cast<boost::uintmax_t>(index), first, second, seed_error, static_cast<T*>(0), static_cast<T*>(0), static_cast<T*>(0));
+
+    detail::reversed_recurrence_coefficients<Coefficients> reversed(get_coefs);
+    const recurrence_method method = detail::solve_recurrence_relation_upward(reversed, static_cast<boost::uintmax_t>(-index), first, second, seed_error, static_cast<T*>(0), static_cast<T*>(0), static_cast<T*>(0));
+    return (method == recurrence_forward) ? recurrence_backward : method;
+  }
+
+  // solves homogeneous difference equation
+  // a(n)w(n+1) - b(n)w(n) + c(n)w(n-1) = 0
+  // for w(index) in whichever way is stable for the solution at hand:
+  // plain stepping when the solution is dominant in the direction of
+  // index (or the roots of the characteristic equation are too close for
+  // it to matter), Miller's or Olver's method when it is minimal there.
+  // Telling which costs a few dozen steps of Miller's method, beyond the
+  // stable steps up to the first index with the roots apart, which the
+  // forward way goes on from
+  //
+  // Params:
+  // get_coefs: functor returning a tuple, where
+  //            get<0>() is a(n); get<1>() is b(n); get<2>() is c(n);
+  //            indexed as for solve_recurrence_relation_forward when
+  //            index > 0 and as for solve_recurrence_relation_backward
+  //            when index < 0;
+  // index: index N to be found, of either sign;
+  // first: w(0);
+  // second: w(1) when index > 0, w(-1) when index < 0; Miller's and
+  //         Olver's method only need w(0) and use it to tell the solutions apart;
+  // error: if not null, receives an estimate of the relative error
+  //        the recurrence adds to that of first and second;
+  // method: if not null, receives the way taken;
+  // previous: if not null, receives w(N-1) when index > 0 and w(N+1) when
+  //           index < 0 (left untouched when N is zero);
+  // seed_error: the relative error of first and second; the solution is
+  //             taken for the minimal one if second / first is the minimal
+  //             ratio to within it, so seeds known only to a few hundred
+  //             epsilon must say so to get Miller's or Olver's method;
+  //             a dominant part below that, which takes over only further
+  //             on, the seeds do not tell, and neither way recovers it
+  //
+  template <class T, class Coefficients>
+  inline T solve_recurrence_relation(Coefficients& get_coefs, boost::intmax_t index, const T& first, const T& second, T* error = 0, recurrence_method* method = 0, T* previous = 0, const T& seed_error = 0)
+  {
+    BOOST_STATIC_ASSERT_MSG(detail::is_homogeneous<Coefficients>::value, "solve_recurrence_relation takes homogeneous recurrences only");
+
+    T result = 0;
+
+    if (index >= 0)
+    {
+      const recurrence_method settled = detail::solve_recurrence_relation_upward(get_coefs, static_cast<boost::uintmax_t>(index), first, second, seed_error, &result, error, previous);
+      if (method)
+        *method = settled;
+      return result;
+    }
+
+    detail::reversed_recurrence_coefficients<Coefficients> reversed(get_coefs);
+    const recurrence_method settled = detail::solve_recurrence_relation_upward(reversed, static_cast<boost::uintmax_t>(-index), first, second, seed_error, &result, error, previous);
+
+    if (method)
+      *method = (settled == recurrence_forward) ? recurrence_backward : settled;
+
+    return result;
   }
 
   } } } // namespaces
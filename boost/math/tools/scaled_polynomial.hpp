@@ -0,0 +1,253 @@
+//  (C) Copyright Anton Bikineev 2014
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_SCALED_POLYNOMIAL_HPP_
+  #define BOOST_MATH_TOOLS_SCALED_POLYNOMIAL_HPP_
+
+  #include <algorithm>
+  #include <cstddef>
+  #include <limits>
+  #include <vector>
+
+  #include <boost/assert.hpp>
+  #include <boost/mpl/bool.hpp>
+
+  #include <boost/math/tools/config.hpp>
+  #include <boost/math/tools/inplace_arithmetic.hpp>
+  #include <boost/math/tools/precision.hpp>
+
+  // A polynomial p(z) = sum(k <= n) c(k) z^k stored as d(k) = c(k) / 2^(e k)
+  // and evaluated as sum d(k) w^k with w = z 2^e. The exponent e keeps the
+  // d(k) well inside the range of T, away from overflow and from the
+  // subnormals alike, so the coefficients of high degree polynomials such
+  // as the terminating hypergeometric series stay representable even where
+  // the c(k) themselves are not, and the power of two adds no rounding.
+  // Should they span more than the range of T, the highest degrees, of
+  // the smallest coefficients, underflow first.
+  //
+  // A single point is evaluated by Estrin's scheme in blocks of four
+  // coefficients, which halves the chain of dependent operations of
+  // Horner's rule, or by Horner's rule in place for multiprecision types.
+  // Many points are evaluated by Horner's rule in lockstep over blocks of
+  // eight, independent chains which vectorize for the builtin types.
+
+  namespace boost { namespace math { namespace tools {
+
+  template <class T>
+  class scaled_polynomial
+  {
+  public:
+    typedef T value_type;
+
+    scaled_polynomial(): exponent(0), factor(1)
+    {
+    }
+
+    // from the scaled coefficients d(0), ..., d(n) and e
+    scaled_polynomial(const std::vector<T>& scaled_coefficients, int exponent):
+      coefficients(scaled_coefficients), exponent(exponent), factor(power_of_two(exponent))
+    {
+      BOOST_ASSERT(!coefficients.empty());
+    }
+
+    // narrows (or widens) the coefficients of another type
+    template <class U>
+    explicit scaled_polynomial(const scaled_polynomial<U>& other):
+      exponent(other.scale_exponent()), factor(power_of_two(other.scale_exponent()))
+    {
+      coefficients.reserve(other.scaled_coefficients().size());
+      for (std::size_t k = 0; k < other.scaled_coefficients().size(); ++k)
+        coefficients.push_back(static_cast<T>(other.scaled_coefficients()[k]));
+    }
+
+    // p(z)
+    T operator()(const T& z) const
+    {
+      BOOST_ASSERT(!coefficients.empty());
+
+      return evaluate_one(T(z * factor), typename inplace_arithmetic<T>::type());
+    }
+
+    // *out++ = p(*first++) for each point of [first, last)
+    template <class InputIterator, class OutputIterator>
+    OutputIterator evaluate(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+      BOOST_ASSERT(!coefficients.empty());
+
+      return evaluate_many(first, last, out, typename inplace_arithmetic<T>::type());
+    }
+
+    // sum |c(k) z^k| / |p(z)|, the relative error of p(z) is
+    // about this many epsilon as the terms cancel
+    T condition_number(const T& z) const
+    {
+      BOOST_MATH_STD_USING // fabs
+      BOOST_ASSERT(!coefficients.empty());
+
+      const T w = fabs(T(z * factor));
+
+      T absolute = fabs(coefficients.back());
+      for (std::size_t k = coefficients.size() - 1u; k > 0u; --k)
+        absolute = (absolute * w) + fabs(coefficients[k - 1u]);
+
+      const T value = fabs((*this)(z));
+      return (value == 0) ? boost::math::tools::max_value<T>() : T(absolute / value);
+    }
+
+    std::size_t degree() const { return coefficients.size() - 1u; }
+
+    // d(k) = c(k) / 2^(e k) and e
+    const std::vector<T>& scaled_coefficients() const { return coefficients; }
+    int scale_exponent() const { return exponent; }
+
+  private:
+    static T power_of_two(int e)
+    {
+      BOOST_MATH_STD_USING // ldexp
+      return ldexp(T(1), e);
+    }
+
+    // Horner's rule for eight points at once, the lanes spelled out
+    // so that they stay in registers and vectorize for the builtin types
+    template <class InputIterator, class OutputIterator>
+    OutputIterator evaluate_many(InputIterator first, InputIterator last, OutputIterator out, boost::mpl::false_) const
+    {
+      T w[8], p[8];
+
+      while (first != last)
+      {
+        unsigned n = 0;
+        for (; (n < 8u) && (first != last); ++n, ++first)
+          w[n] = T(*first) * factor;
+
+        // the lanes past the end repeat the first point
+        for (unsigned i = n; i < 8u; ++i)
+          w[i] = w[0];
+
+        std::fill(p, p + 8, coefficients.back());
+
+        for (std::size_t k = coefficients.size() - 1u; k > 0u; --k)
+        {
+          const T c = coefficients[k - 1u];
+          p[0] = (p[0] * w[0]) + c; p[1] = (p[1] * w[1]) + c;
+          p[2] = (p[2] * w[2]) + c; p[3] = (p[3] * w[3]) + c;
+          p[4] = (p[4] * w[4]) + c; p[5] = (p[5] * w[5]) + c;
+          p[6] = (p[6] * w[6]) + c; p[7] = (p[7] * w[7]) + c;
+        }
+
+        out = std::copy(p, p + n, out);
+      }
+
+      return out;
+    }
+
+    // one point after another for multiprecision types
+    template <class InputIterator, class OutputIterator>
+    OutputIterator evaluate_many(InputIterator first, InputIterator last, OutputIterator out, boost::mpl::true_) const
+    {
+      T w;
+      for (; first != last; ++first, ++out)
+      {
+        w = *first;
+        w *= factor;
+        *out = evaluate_one(w, boost::mpl::true_());
+      }
+
+      return out;
+    }
+
+    // Estrin's scheme within blocks of four coefficients,
+    // Horner's rule in w^4 across the blocks
+    T evaluate_one(const T& w, boost::mpl::false_) const
+    {
+      const std::size_t size = coefficients.size();
+      const std::size_t full = size & ~std::size_t(3u);
+
+      const T w2 = w * w;
+      const T w4 = w2 * w2;
+
+      // the top, incomplete block by Horner's rule
+      T result = 0;
+      for (std::size_t k = size; k > full; --k)
+        result = (result * w) + coefficients[k - 1u];
+
+      for (std::size_t k = full; k > 0u; k -= 4u)
+      {
+        const T low = coefficients[k - 4u] + (coefficients[k - 3u] * w);
+        const T high = coefficients[k - 2u] + (coefficients[k - 1u] * w);
+        result = (result * w4) + (low + (high * w2));
+      }
+
+      return result;
+    }
+
+    // Horner's rule without temporaries
+    T evaluate_one(const T& w, boost::mpl::true_) const
+    {
+      T result = coefficients.back();
+      for (std::size_t k = coefficients.size() - 1u; k > 0u; --k)
+      {
+        result *= w;
+        result += coefficients[k - 1u];
+      }
+
+      return result;
+    }
+
+    std::vector<T> coefficients;
+    int exponent;
+    T factor; // 2^e
+  };
+
+  // the polynomial with c(0) = 1 and c(k + 1) = c(k) * ratio(k) for k < degree,
+  // the terms of a terminating series; the coefficients are formed scaled in
+  // T, so none of them overflows on the way, and are rounded to ResultType,
+  // whose range the scaling is chosen for, once at the end
+  template <class ResultType, class T, class Ratio>
+  inline scaled_polynomial<ResultType> make_scaled_polynomial(const Ratio& ratio, const unsigned degree)
+  {
+    BOOST_MATH_STD_USING // ceil, fabs, floor, ldexp, log
+
+    // log2|d(k)| = log2|c(k)| - e k is to stay within [lower, upper], a
+    // product of two d(k) away from either end of the range of ResultType: every
+    // k bounds e from below and from above, and e is taken halfway between
+    // the tightest bounds, as far from overflow as from underflow
+    const T ln2 = log(T(2));
+    const T upper = T(boost::math::tools::log_max_value<ResultType>() / 2) / ln2;
+    const T lower = T(boost::math::tools::log_min_value<ResultType>() / 2) / ln2;
+
+    T log2_c = 0;
+    T from_below = -boost::math::tools::max_value<T>();
+    T from_above = boost::math::tools::max_value<T>();
+    for (unsigned k = 0; k < degree; ++k)
+    {
+      // partial sums of log2|ratio|, the c(k) themselves may be out of range
+      log2_c += log(fabs(T(ratio(k)))) / ln2;
+      from_below = (std::max)(from_below, T((log2_c - upper) / (k + 1)));
+      from_above = (std::min)(from_above, T((log2_c - lower) / (k + 1)));
+    }
+
+    // where no e fits, as the coefficients span more than the range,
+    // overflow is avoided and the smallest of them, of the highest
+    // degrees, are let underflow
+    const T e = (from_below <= from_above) ? T(floor((from_below + from_above) / 2)) : T(ceil(from_below));
+    const int exponent = (degree == 0) ? 0 : static_cast<int>(e);
+
+    std::vector<ResultType> coefficients(degree + 1u);
+    coefficients[0] = 1;
+
+    T d = 1;
+    for (unsigned k = 0; k < degree; ++k)
+    {
+      d = ldexp(d * ratio(k), -exponent);
+      coefficients[k + 1u] = static_cast<ResultType>(d);
+    }
+
+    return scaled_polynomial<ResultType>(coefficients, exponent);
+  }
+
+  } } } // namespaces
+
+#endif // BOOST_MATH_TOOLS_SCALED_POLYNOMIAL_HPP_
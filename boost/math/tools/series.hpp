@@ -147,6 +147,57 @@ inline typename Functor::result_type sum_series(Functor& func, int bits, const U
    return sum_series(func, bits, iters, init_value);
 }
 
+//
+// Sums an asymptotic (divergent) series up to its smallest term:
+// stops when the next term is below factor relative to the sum, or
+// as soon as the terms grow again after having decreased. Returns the
+// sum together with the magnitude of the last term added (the first
+// term omitted, on convergence), which estimates the truncation error.
+//
+template <class Functor, class U>
+inline std::pair<typename Functor::result_type, typename Functor::result_type> sum_asymptotic_series(Functor& func, const U& factor, boost::uintmax_t& max_terms)
+{
+   BOOST_MATH_STD_USING
+
+   typedef typename Functor::result_type result_type;
+
+   boost::uintmax_t counter = max_terms;
+
+   result_type result = 0;
+   result_type next_term = func();
+   result_type abs_next_term = fabs(next_term);
+   result_type error = abs_next_term;
+   bool has_decreased = false;
+   while(counter)
+   {
+      result += next_term;
+      error = abs_next_term;
+      --counter;
+
+      next_term = func();
+      const result_type abs_term = abs_next_term;
+      abs_next_term = fabs(next_term);
+
+      if(abs_next_term <= fabs(result) * factor)
+      {
+         error = abs_next_term;
+         break;
+      }
+      if(abs_next_term > abs_term)
+      {
+         if(has_decreased)
+            break;
+      }
+      else
+         has_decreased = true;
+   }
+
+   // set max_terms to the actual number of terms of the series evaluated:
+   max_terms = max_terms - counter;
+
+   return std::make_pair(result, error);
+}
+
 //
 // Algorithm kahan_sum_series invokes Functor func until the N'th
 // term is too small to have any effect on the total, the terms
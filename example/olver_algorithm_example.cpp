@@ -79,4 +79,16 @@ int main()
       initial
       )
     << std::endl;
+
+  // the same keeping only O(sqrt(m)) steps of the forward pass, which is what
+  // makes a million steps fit in memory for multiprecision types: the forward
+  // pass of a wide exponent range type never comes close to overflow, so it
+  // would otherwise store all of them
+  std::cout << boost::math::tools::solve_recurrence_relation_by_olver_checkpointed(
+      s,
+      boost::math::tools::epsilon<float_type>(),
+      m,
+      initial
+      )
+    << std::endl;
 }
@@ -0,0 +1,136 @@
+//  (C) Copyright Anton Bikineev 2014.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+#include <boost/math/tools/binary_test_data.hpp>
+#include <boost/array.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//
+// DESCRIPTION:
+// ~~~~~~~~~~~~
+//
+// This file tests that tables written by write_binary_test_data come back
+// unchanged through binary_test_data, also when they were stored in a
+// narrower type than the one they are read as, and that files with a
+// header that does not match, or that were cut short, are rejected.
+//
+
+namespace {
+
+const char* const binary_test_data_path = "test_binary_test_data.bin";
+
+template <class S, class Rows>
+std::string binary_test_data_image(const Rows& rows)
+{
+  std::ostringstream os(std::ios_base::out | std::ios_base::binary);
+  boost::math::tools::write_binary_test_data<S>(os, rows);
+  return os.str();
+}
+
+void write_file(const std::string& image)
+{
+  std::ofstream ofs(binary_test_data_path, std::ios_base::out | std::ios_base::binary);
+  ofs.write(image.data(), image.size());
+}
+
+// the image with the 32 bit header field at offset replaced
+std::string patched(std::string image, std::size_t offset, boost::uint32_t value)
+{
+  std::memcpy(&image[offset], &value, sizeof(value));
+  return image;
+}
+
+template <class T>
+void check_rejected(const std::string& image)
+{
+  write_file(image);
+  BOOST_CHECK_THROW((boost::math::tools::binary_test_data<T, 4>(binary_test_data_path)), std::runtime_error);
+}
+
+}
+
+template <class T>
+void test_binary_test_data(T, const char* type_name)
+{
+  std::cout << "Testing binary test data with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  std::vector<boost::array<T, 4> > table;
+  for (int i = 0; i < 100; ++i)
+  {
+    const boost::array<T, 4> row = {{ T(i) / 3, T(-i) / 7, T(1) / (i + 1), std::numeric_limits<T>::epsilon() * i }};
+    table.push_back(row);
+  }
+
+  // a round trip in the same type is exact
+  {
+    write_file(binary_test_data_image<T>(table));
+    const boost::math::tools::binary_test_data<T, 4> data(binary_test_data_path);
+    BOOST_CHECK_EQUAL(data.size(), table.size());
+    for (std::size_t i = 0; i < table.size(); ++i)
+    {
+      const boost::array<T, 4> row = data[i];
+      for (std::size_t j = 0; j < 4; ++j)
+        BOOST_CHECK_EQUAL(row[j], table[i][j]);
+    }
+  }
+
+  // values stored as float are read as the floats they were rounded to
+  {
+    write_file(binary_test_data_image<float>(table));
+    const boost::math::tools::binary_test_data<T, 4> data(binary_test_data_path);
+    BOOST_CHECK_EQUAL(data.size(), table.size());
+    for (std::size_t i = 0; i < table.size(); ++i)
+    {
+      const boost::array<T, 4> row = data[i];
+      for (std::size_t j = 0; j < 4; ++j)
+        BOOST_CHECK_EQUAL(row[j], T(static_cast<float>(table[i][j])));
+    }
+  }
+
+  // byte order at offset 8, version at 12, value size at 16,
+  // columns at 24, and the magic
+  const std::string image = binary_test_data_image<T>(table);
+  check_rejected<T>(patched(image, 8u, 0x04030201u));
+  check_rejected<T>(patched(image, 12u, boost::math::tools::binary_test_data_version + 1));
+  check_rejected<T>(patched(image, 24u, 3u));
+  check_rejected<T>(patched(image, 16u, 3u));
+  check_rejected<T>(std::string("NOTDATA") + image.substr(7u));
+
+  {
+    write_file(binary_test_data_image<T>(table));
+    BOOST_CHECK_THROW((boost::math::tools::binary_test_data<T, 3>(binary_test_data_path)), std::runtime_error);
+  }
+
+  // cut short in the last row, and in the header
+  check_rejected<T>(image.substr(0u, image.size() - 1u));
+  check_rejected<T>(image.substr(0u, 63u));
+
+  // rows of different sizes are refused by the writer
+  std::vector<std::vector<T> > ragged(2u, std::vector<T>(4u));
+  ragged.back().pop_back();
+  std::ostringstream os(std::ios_base::out | std::ios_base::binary);
+  BOOST_CHECK_THROW(boost::math::tools::write_binary_test_data<T>(os, ragged), std::invalid_argument);
+
+  std::remove(binary_test_data_path);
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+  test_binary_test_data(0.1, "double");
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+  test_binary_test_data(0.1L, "long double");
+#endif
+}
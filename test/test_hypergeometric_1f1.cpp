@@ -55,6 +55,50 @@ void expected_results()
       ".*",                 // test data group
       ".*", 1, 1);          // test function
 
+  // 0F1 by Bessel functions: rounding 2 sqrt(|z|) costs up to
+  // about 2 sqrt(|z|) epsilon, some 1000 at the largest points
+  add_expected_result(
+      ".*",                 // compiler
+      ".*",                 // stdlib
+      ".*",                 // platform
+      largest_type,         // test type(s)
+      ".*Bessel route.*",   // test data group
+      ".*", 1500, 600);     // test function
+
+  add_expected_result(
+      ".*",                 // compiler
+      ".*",                 // stdlib
+      ".*",                 // platform
+      "double",             // test type(s)
+      ".*Bessel route.*",   // test data group
+      ".*", 1, 1);          // test function
+
+  // closed forms: the error is that of the special function
+  // evaluated, worst for the Bessel I form of 1F1(a; 2a; z)
+  add_expected_result(
+      ".*",                 // compiler
+      ".*",                 // stdlib
+      ".*",                 // platform
+      largest_type,         // test type(s)
+      ".*closed forms.*",   // test data group
+      ".*", 8, 3);          // test function
+
+  add_expected_result(
+      ".*",                 // compiler
+      ".*",                 // stdlib
+      ".*",                 // platform
+      "double",             // test type(s)
+      ".*closed forms.*",   // test data group
+      ".*", 1, 1);          // test function
+
+  add_expected_result(
+      ".*",                 // compiler
+      ".*",                 // stdlib
+      ".*",                 // platform
+      "(long\\s+)?double",  // test type(s)
+      ".*compensated.*",    // test data group
+      ".*", 10, 2);         // test function
+
   add_expected_result(
       ".*",                 // compiler
       ".*",                 // stdlib
@@ -12,6 +12,11 @@
 #include <boost/math/special_functions/math_fwd.hpp>
 #include <boost/type_traits/is_floating_point.hpp>
 #include <boost/array.hpp>
+#include <boost/math/tools/binary_test_data.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
 #include "functor.hpp"
 
 #include "handle_test_result.hpp"
@@ -32,6 +37,49 @@ T hypergeometric_1f1_int_wrapper(T a, T b, T z)
   );
 }
 
+// twice the digits of T, which switches the series, rational and Pade
+// kernels to compensated accumulation, see boost/math/tools/double_double.hpp
+template <class T>
+T hypergeometric_1f1_compensated_wrapper(T a, T b, T z)
+{
+  typedef boost::math::policies::policy<
+    boost::math::policies::digits2<2 * std::numeric_limits<T>::digits>,
+    boost::math::policies::promote_double<false> > compensated_policy;
+  return boost::math::hypergeometric_1f1(a, b, z, compensated_policy());
+}
+
+template <class T>
+T hypergeometric_1f1_first_derivative_wrapper(T a, T b, T z)
+{
+  T first = 0;
+  boost::math::hypergeometric_1f1_and_derivatives(a, b, z, &first);
+  return first;
+}
+
+template <class T>
+T hypergeometric_1f1_second_derivative_wrapper(T a, T b, T z)
+{
+  T second = 0;
+  boost::math::hypergeometric_1f1_and_derivatives(a, b, z, static_cast<T*>(0), &second);
+  return second;
+}
+
+template <class T>
+T hypergeometric_1f1_a_derivative_wrapper(T a, T b, T z)
+{
+  T da = 0;
+  boost::math::hypergeometric_1f1_and_parameter_derivatives(a, b, z, &da, static_cast<T*>(0));
+  return da;
+}
+
+template <class T>
+T hypergeometric_1f1_b_derivative_wrapper(T a, T b, T z)
+{
+  T db = 0;
+  boost::math::hypergeometric_1f1_and_parameter_derivatives(a, b, z, static_cast<T*>(0), &db);
+  return db;
+}
+
 template <class Real, class T>
 void do_test_hypergeometric_1f1(const T& data, const char* type_name, const char* test_name)
 {
@@ -60,6 +108,118 @@ void do_test_hypergeometric_1f1(const T& data, const char* type_name, const char
   std::cout << std::endl;
 }
 
+template <class Real, class T>
+void do_test_hypergeometric_1f2(const T& data, const char* type_name, const char* test_name)
+{
+  typedef Real                   value_type;
+
+  typedef value_type (*pg)(value_type, value_type, value_type, value_type);
+#if defined(BOOST_MATH_NO_DEDUCED_FUNCTION_POINTERS)
+  pg funcp = boost::math::hypergeometric_1f2<value_type, value_type, value_type, value_type>;
+#else
+  pg funcp = boost::math::hypergeometric_1f2;
+#endif
+
+  boost::math::tools::test_result<value_type> result;
+
+  std::cout << "Testing " << test_name << " with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  //
+  // test hypergeometric_1f2 against data:
+  //
+  result = boost::math::tools::test_hetero<Real>(
+    data,
+    bind_func<Real>(funcp, 0, 1, 2, 3),
+    extract_result<Real>(4));
+  handle_test_result(result, data[result.worst()], result.worst(), type_name, "boost::math::hypergeometric_1f2", test_name);
+  std::cout << std::endl;
+}
+
+template <class Real, class T>
+void do_test_hypergeometric_0f1(const T& data, const char* type_name, const char* test_name)
+{
+  typedef Real                   value_type;
+
+  typedef value_type (*pg)(value_type, value_type);
+#if defined(BOOST_MATH_NO_DEDUCED_FUNCTION_POINTERS)
+  pg funcp = boost::math::hypergeometric_0f1<value_type, value_type>;
+#else
+  pg funcp = boost::math::hypergeometric_0f1;
+#endif
+
+  boost::math::tools::test_result<value_type> result;
+
+  std::cout << "Testing " << test_name << " with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  //
+  // test hypergeometric_0f1 against data:
+  //
+  result = boost::math::tools::test_hetero<Real>(
+    data,
+    bind_func<Real>(funcp, 0, 1),
+    extract_result<Real>(2));
+  handle_test_result(result, data[result.worst()], result.worst(), type_name, "boost::math::hypergeometric_0f1", test_name);
+  std::cout << std::endl;
+}
+
+template <class Real, class T>
+void do_test_hypergeometric_2f1(const T& data, const char* type_name, const char* test_name)
+{
+  typedef Real                   value_type;
+
+  typedef value_type (*pg)(value_type, value_type, value_type, value_type);
+#if defined(BOOST_MATH_NO_DEDUCED_FUNCTION_POINTERS)
+  pg funcp = boost::math::hypergeometric_2f1<value_type, value_type, value_type, value_type>;
+#else
+  pg funcp = boost::math::hypergeometric_2f1;
+#endif
+
+  boost::math::tools::test_result<value_type> result;
+
+  std::cout << "Testing " << test_name << " with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  //
+  // test hypergeometric_2f1 against data:
+  //
+  result = boost::math::tools::test_hetero<Real>(
+    data,
+    bind_func<Real>(funcp, 0, 1, 2, 3),
+    extract_result<Real>(4));
+  handle_test_result(result, data[result.worst()], result.worst(), type_name, "boost::math::hypergeometric_2f1", test_name);
+  std::cout << std::endl;
+}
+
+template <class Real, class T>
+void do_test_hypergeometric_1f1_compensated(const T& data, const char* type_name, const char* test_name)
+{
+  typedef Real                   value_type;
+
+  typedef value_type (*pg)(value_type, value_type, value_type);
+#if defined(BOOST_MATH_NO_DEDUCED_FUNCTION_POINTERS)
+  pg funcp = hypergeometric_1f1_compensated_wrapper<value_type>;
+#else
+  pg funcp = hypergeometric_1f1_compensated_wrapper;
+#endif
+
+  boost::math::tools::test_result<value_type> result;
+
+  std::cout << "Testing " << test_name << " with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  //
+  // test hypergeometric_1f1 with compensated accumulation against data:
+  //
+  result = boost::math::tools::test_hetero<Real>(
+    data,
+    bind_func<Real>(funcp, 0, 1, 2),
+    extract_result<Real>(3));
+  handle_test_result(result, data[result.worst()], result.worst(), type_name, "boost::math::hypergeometric_1f1", test_name);
+  std::cout << std::endl;
+}
+
 template <class Real, class T>
 void do_test_hypergeometric_1f1_int(const T& data, const char* type_name, const char* test_name)
 {
@@ -88,6 +248,347 @@ void do_test_hypergeometric_1f1_int(const T& data, const char* type_name, const
   std::cout << std::endl;
 }
 
+template <class Real, class T>
+void do_test_hypergeometric_1f1_derivatives(const T& data, const char* type_name, const char* test_name)
+{
+  typedef Real                   value_type;
+
+  typedef value_type (*pg)(value_type, value_type, value_type);
+#if defined(BOOST_MATH_NO_DEDUCED_FUNCTION_POINTERS)
+  pg first_funcp = hypergeometric_1f1_first_derivative_wrapper<value_type>;
+  pg second_funcp = hypergeometric_1f1_second_derivative_wrapper<value_type>;
+#else
+  pg first_funcp = hypergeometric_1f1_first_derivative_wrapper;
+  pg second_funcp = hypergeometric_1f1_second_derivative_wrapper;
+#endif
+
+  boost::math::tools::test_result<value_type> result;
+
+  std::cout << "Testing " << test_name << " with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  //
+  // test the derivatives of hypergeometric_1f1_and_derivatives against data:
+  //
+  result = boost::math::tools::test_hetero<Real>(
+    data,
+    bind_func<Real>(first_funcp, 0, 1, 2),
+    extract_result<Real>(3));
+  handle_test_result(result, data[result.worst()], result.worst(), type_name, "boost::math::hypergeometric_1f1_and_derivatives (first)", test_name);
+
+  result = boost::math::tools::test_hetero<Real>(
+    data,
+    bind_func<Real>(second_funcp, 0, 1, 2),
+    extract_result<Real>(4));
+  handle_test_result(result, data[result.worst()], result.worst(), type_name, "boost::math::hypergeometric_1f1_and_derivatives (second)", test_name);
+  std::cout << std::endl;
+}
+
+template <class Real, class T>
+void do_test_hypergeometric_1f1_parameter_derivatives(const T& data, const char* type_name, const char* test_name)
+{
+  typedef Real                   value_type;
+
+  typedef value_type (*pg)(value_type, value_type, value_type);
+#if defined(BOOST_MATH_NO_DEDUCED_FUNCTION_POINTERS)
+  pg a_funcp = hypergeometric_1f1_a_derivative_wrapper<value_type>;
+  pg b_funcp = hypergeometric_1f1_b_derivative_wrapper<value_type>;
+#else
+  pg a_funcp = hypergeometric_1f1_a_derivative_wrapper;
+  pg b_funcp = hypergeometric_1f1_b_derivative_wrapper;
+#endif
+
+  boost::math::tools::test_result<value_type> result;
+
+  std::cout << "Testing " << test_name << " with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  //
+  // test the derivatives of hypergeometric_1f1_and_parameter_derivatives against data:
+  //
+  result = boost::math::tools::test_hetero<Real>(
+    data,
+    bind_func<Real>(a_funcp, 0, 1, 2),
+    extract_result<Real>(3));
+  handle_test_result(result, data[result.worst()], result.worst(), type_name, "boost::math::hypergeometric_1f1_and_parameter_derivatives (a)", test_name);
+
+  result = boost::math::tools::test_hetero<Real>(
+    data,
+    bind_func<Real>(b_funcp, 0, 1, 2),
+    extract_result<Real>(4));
+  handle_test_result(result, data[result.worst()], result.worst(), type_name, "boost::math::hypergeometric_1f1_and_parameter_derivatives (b)", test_name);
+  std::cout << std::endl;
+}
+
+// hypergeometric_1f1_grid in either layout and on one or more threads
+// against hypergeometric_1f1 point by point
+template <class T>
+void check_hypergeometric_1f1_grid(const std::vector<T>& a, const std::vector<T>& b, const std::vector<T>& z,
+                                   boost::math::hypergeometric_grid_layout layout, unsigned threads)
+{
+  const T tolerance = 100 * boost::math::tools::epsilon<T>();
+
+  std::vector<T> result(a.size() * b.size() * z.size());
+  boost::math::hypergeometric_1f1_grid(a.begin(), a.end(), b.begin(), b.end(), z.begin(), z.end(), result.begin(), layout, threads);
+
+  for (std::size_t i = 0u; i < a.size(); ++i)
+  {
+    for (std::size_t j = 0u; j < b.size(); ++j)
+    {
+      for (std::size_t k = 0u; k < z.size(); ++k)
+      {
+        const std::size_t index = (layout == boost::math::hypergeometric_grid_row_major) ?
+          (((i * b.size()) + j) * z.size()) + k :
+          (((k * b.size()) + j) * a.size()) + i;
+        BOOST_CHECK_CLOSE_FRACTION(result[index], boost::math::hypergeometric_1f1(a[i], b[j], z[k]), tolerance);
+      }
+    }
+  }
+}
+
+template <class T>
+void test_hypergeometric_1f1_grid(T)
+{
+  std::vector<T> z;
+  z.push_back(T(-3.5));
+  z.push_back(T(0.5));
+  z.push_back(T(2));
+  z.push_back(T(12.5));
+
+  // a unit spaced run of a, walked by recurrence, and a point off the run
+  std::vector<T> a, b;
+  for (int i = 0; i < 16; ++i)
+    a.push_back(T(-4.75 + i));
+  a.push_back(T(30.5));
+  b.push_back(T(1.5));
+  b.push_back(T(2.25));
+  b.push_back(T(7.5));
+
+  check_hypergeometric_1f1_grid(a, b, z, boost::math::hypergeometric_grid_row_major, 1u);
+  check_hypergeometric_1f1_grid(a, b, z, boost::math::hypergeometric_grid_column_major, 3u);
+
+  // a longer unit spaced run of b, split between threads
+  a.clear();
+  b.clear();
+  a.push_back(T(0.5));
+  a.push_back(T(2.25));
+  for (int j = 0; j < 20; ++j)
+    b.push_back(T(1.75 + j));
+
+  check_hypergeometric_1f1_grid(a, b, z, boost::math::hypergeometric_grid_row_major, 3u);
+  check_hypergeometric_1f1_grid(a, b, z, boost::math::hypergeometric_grid_column_major, 1u);
+}
+
+// hypergeometric_1f1_sweep over a dense scan of z against mpmath values
+// of M and dM/dz at every twentieth point; the error is measured against
+// max(|M|, |z M'|), the scale of a perturbation of z, since the points
+// pass close to the zeros of M
+template <class T, class Data>
+void check_hypergeometric_1f1_sweep(const T& a, const T& b, const std::vector<T>& z, unsigned threads, const Data& data)
+{
+  BOOST_MATH_STD_USING // fabs
+
+  const T tolerance = 100 * boost::math::tools::epsilon<T>();
+
+  std::vector<T> result(z.size());
+  boost::math::hypergeometric_1f1_sweep(a, b, z.begin(), z.end(), result.begin(), threads);
+
+  for (std::size_t i = 0u; i < data.size(); ++i)
+  {
+    const T point = T(data[i][0]);
+    const T expected = T(data[i][1]);
+    const T first = T(data[i][2]);
+
+    const std::size_t k = std::find(z.begin(), z.end(), point) - z.begin();
+    BOOST_REQUIRE(k < z.size());
+
+    const T scale = (std::max)(T(fabs(expected)), T(fabs(point * first)));
+    BOOST_CHECK_LE(T(fabs(result[k] - expected)), T(tolerance * scale));
+  }
+}
+
+template <class T>
+void test_hypergeometric_1f1_sweep(T)
+{
+  // a dense scan across z = 0, once sorted and once in reverse
+  // with two points out of order, which are sorted first
+  std::vector<T> z, unsorted;
+  for (int i = 0; i <= 400; ++i)
+    z.push_back(T(-20 + i / T(10)));
+  unsorted.assign(z.rbegin(), z.rend());
+  std::swap(unsorted[3], unsorted[200]);
+
+  // z, M(a, b, z) and dM/dz calculated with mpmath
+  static const boost::array<boost::array<T, 3>, 21> sweep_half_three_halves_data = {{ // a = 0.5, b = 1.5
+    {{ SC_(-20), SC_(1.98166364829973654095098794158925057698133515516422138841767e-1), SC_(4.95415906922050079141352415482461693855781347851537158106657e-3) }},
+    {{ SC_(-18), SC_(2.0888568914041529412579589789192203117753549005539028562715e-1), SC_(5.80237983084543192814354060431368882389176744112630405235661e-3) }},
+    {{ SC_(-16), SC_(2.21556727947392236442919733133162656198297959300882484858151e-1), SC_(6.92364423163179741199391310493698737722207254250255710012028e-3) }},
+    {{ SC_(-14), SC_(2.36854079978670669759590389365974254542300271627704567292765e-1), SC_(8.45904458749827022113236876360113176000020228461927081142748e-3) }},
+    {{ SC_(-12), SC_(2.55831430529383064141177290615614022343677451164368050763713e-1), SC_(1.06593869298762389971424420128098007004735927989605484379474e-2) }},
+    {{ SC_(-10), SC_(2.80247390506642740635340644899705150395520126269919266319033e-1), SC_(1.40100995288440127891902526692072299892641104090526350674887e-2) }},
+    {{ SC_(-8), SC_(3.13308687321307169163531614306047527521202982044350965212519e-1), SC_(1.95608265433377910827943890737666666563682551194144153657484e-2) }},
+    {{ SC_(-6), SC_(3.61608147353658496683933509245434275342553824511821367138932e-1), SC_(2.99274495980826781884073618178848006209206120771906185073378e-2) }},
+    {{ SC_(-4), SC_(4.41040695381210839983740517957027018612025885434278234005174e-1), SC_(5.28406320615595824612528120854732220500142272351003299044468e-2) }},
+    {{ SC_(-2), SC_(5.98144006661304101465711885237171359544993930771623732306078e-1), SC_(1.1570218085617285239292809756617173903434059621551196270948e-1) }},
+    {{ SC_(0), SC_(1), SC_(3.33333333333333333333333333333333333333333333333333333333333e-1) }},
+    {{ SC_(2), SC_(2.36445389280520928459715937138496832433537497941332855882226), SC_(1.25615055153136023565831702229750987221123514778462969131622) }},
+    {{ SC_(4), SC_(8.22631388275361511236820222708393765454221188597998372424694), SC_(5.79647951879882799571775737197211759353106564407926062519746) }},
+    {{ SC_(6), SC_(3.77300558340600250701250400187079138853020361981297100094845e+1), SC_(3.04748948048895914615218450437233638100498217632499577170402e+1) }},
+    {{ SC_(8), SC_(2.01509999417864680685833951322861090521093366209492144140332e+2), SC_(1.73715499226491474628609884258126723952179660807708972379289e+2) }},
+    {{ SC_(10), SC_(1.16823046357943892964646234381419603918049912510307714518411e+3), SC_(1.04291176656136387936557191507350241635865067467268519645257e+3) }},
+    {{ SC_(12), SC_(7.11056248852450427994480311471097051955630897730286231289192e+3), SC_(6.48517620543664235533585007432399219377720731255907950544435e+3) }},
+    {{ SC_(14), SC_(4.46894929443837281659632946269415896309761774826775203336798e+4), SC_(4.13540996864426089136883384336042092779110844961937399992718e+4) }},
+    {{ SC_(16), SC_(2.87350158647482592719734759394701677292368838359169208798436e+5), SC_(2.68711261308137188876352780668335896047198468234295925968299e+5) }},
+    {{ SC_(18), SC_(1.8795171716437953693971762440136612072419613923411197888137e+6), SC_(1.77167922126907543803859241708462145449928873316238054729665e+6) }},
+    {{ SC_(20), SC_(1.24586004381720117238958525803830511652652140400444967882466e+7), SC_(1.18176648742904566561302744490289376879843443726200689391341e+7) }},
+  }};
+  check_hypergeometric_1f1_sweep(T(0.5), T(1.5), z, 1u, sweep_half_three_halves_data);
+
+  static const boost::array<boost::array<T, 3>, 21> sweep_negative_b_data = {{ // a = 2.25, b = -3.5
+    {{ SC_(-20), SC_(1.10747129400023073118721568773552799804957714425313580123788e-1), SC_(2.61035255342342601617988452452991103871907019718765704909205e-2) }},
+    {{ SC_(-18), SC_(1.87163191788772881893497963388979032911775443410331135292072e-1), SC_(5.39613649790239240074913798694957183933561947604324964993195e-2) }},
+    {{ SC_(-16), SC_(3.46614594029773364370247165502753233562616764363061958331074e-1), SC_(1.11714776199426180238861301086258625810523201577161689415032e-1) }},
+    {{ SC_(-14), SC_(6.57680029265437479528661282630515051815819197063550863791465e-1), SC_(2.02299681172540921574949966689398115919273084099870099599459e-1) }},
+    {{ SC_(-12), SC_(1.12184182794946397726337429209802442110849086152706371194035), SC_(2.32388286849838315799710930622222991497488895421564523789084e-1) }},
+    {{ SC_(-10), SC_(1.31134572273898859188830446077210627269646001424993230311105), SC_(-1.61389806916673442228681651317326088058642585350888723711342e-1) }},
+    {{ SC_(-8), SC_(-1.31439303023431864857123547145372576975449962013952429458533e-1), SC_(-1.41118234695237523496639968202323874398831075912397990946002) }},
+    {{ SC_(-6), SC_(-4.00292521225308889796305141222973072012485253030695016331911), SC_(-1.99162180035778336176203537281988889982675556783026420375213) }},
+    {{ SC_(-4), SC_(-4.59616227496877319105791807755673121435460971641842131905875), SC_(2.22882471265228555909992164505702152041400697461925385409019) }},
+    {{ SC_(-2), SC_(2.21603620422315924144726779870854495046395407135406692650111), SC_(2.03361131752159636509073108626282788901435088318416321574355) }},
+    {{ SC_(0), SC_(1), SC_(-6.42857142857142857142857142857142857142857142857142857142857e-1) }},
+    {{ SC_(2), SC_(5.07811280622195089664440259077985670920738852871145592421956e+2), SC_(1.73282078263181659527512584996384025634315551497986343414372e+3) }},
+    {{ SC_(4), SC_(1.13688994557968694424515658882649843806208138404332034326957e+5), SC_(2.56395186700501292055979046648161025551832936694895608537683e+5) }},
+    {{ SC_(6), SC_(6.59701476445945682006967262956430463569373952701048714212953e+6), SC_(1.22542236568274476855821134428604751073798928633640581634038e+7) }},
+    {{ SC_(8), SC_(2.16913880235308618071384966257275238653584269825018374581284e+8), SC_(3.58803550007493086903050227582810912106557875478033436259424e+8) }},
+    {{ SC_(10), SC_(5.19043982326690550860586143107274514452448361915228383204796e+9), SC_(7.94055559007468659861328605272120593418254703528411955811722e+9) }},
+    {{ SC_(12), SC_(1.01240138941580496564754013698200839631277154504009719775404e+11), SC_(1.46368447402820651125466872012042926265630477690047394304891e+11) }},
+    {{ SC_(14), SC_(1.71162779809657790326438086224162712413497631003402271206091e+12), SC_(2.37053688429449545542367270459692626641355556377183048826552e+12) }},
+    {{ SC_(16), SC_(2.60320419178714214937193137609478327476282069677590460415774e+13), SC_(3.48543303720015310356097639738477707506670787230833459863454e+13) }},
+    {{ SC_(18), SC_(3.64901715283194653946000246086986141589633613755119844339711e+14), SC_(4.75382805146748919637914267631264693796998761930487009797341e+14) }},
+    {{ SC_(20), SC_(4.79370899571951587217208012369008649835022900225073162159522e+15), SC_(6.10551546200745236758343981612599330368699244808156435095949e+15) }},
+  }};
+  check_hypergeometric_1f1_sweep(T(2.25), T(-3.5), unsorted, 3u, sweep_negative_b_data);
+
+  static const boost::array<boost::array<T, 3>, 21> sweep_negative_a_data = {{ // a = -3.5, b = 2.75
+    {{ SC_(-20), SC_(6.79479623806598786540536409586017499012978519103813112358651e+2), SC_(-9.60703217851062450984307294801319903542412737754183311211281e+1) }},
+    {{ SC_(-18), SC_(5.05838583480636980504490451543882039621923631301862601449288e+2), SC_(-7.79460240365473346016316035978553041129191586406190866469069e+1) }},
+    {{ SC_(-16), SC_(3.66225505466534836540288789859240233868860203588760015402774e+2), SC_(-6.20266262400838687197860812080965822011155334309200877578438e+1) }},
+    {{ SC_(-14), SC_(2.56326376129767417093524418000542906479801297246897281022141e+2), SC_(-4.82156299987073400259743739378863849973800784310230021730796e+1) }},
+    {{ SC_(-12), SC_(1.72024651563032139322215219261172506414808946933607959191376e+2), SC_(-3.64119591659811224413546427666958388121135389991542316102453e+1) }},
+    {{ SC_(-10), SC_(1.0941109428401286277155233279038822442853908489247786048763e+2), SC_(-2.65092506742476430608008052082163149388505495126818549340735e+1) }},
+    {{ SC_(-8), SC_(6.47952169567296647328893963637240888388676213240936871981762e+1), SC_(-1.83949452792902248161235728171371746057684336010900254956956e+1) }},
+    {{ SC_(-6), SC_(3.47188133800563556631703281158099646263082849892714767970479e+1), SC_(-1.19490916125197695970582504339753576682087968059702640393958e+1) }},
+    {{ SC_(-4), SC_(1.59722780936874352193131628314916576631391107407284503894383e+1), SC_(-7.04272404587101949440882183373253832698103574580171568800692) }},
+    {{ SC_(-2), SC_(5.61478115763704414956113289540488700926445276786073529747126), SC_(-3.53557874018217106177620208614688202074505697042798233572711) }},
+    {{ SC_(0), SC_(1), SC_(-1.27272727272727272727272727272727272727272727272727272727273) }},
+    {{ SC_(2), SC_(-1.89716132957079778423485997503352796480226263479985115203007e-1), SC_(-7.93278181010610925037129782911912000912425989012704660785449e-2) }},
+    {{ SC_(4), SC_(1.04448423208908767165173937833413745111088244652902360834262e-1), SC_(2.48141470379732601349066319348074936671249501868160807660637e-1) }},
+    {{ SC_(6), SC_(3.89359547498682401467701668206485890787171469977719886050008e-1), SC_(-4.2212571799165796215515713906734376522149516222130595513971e-2) }},
+    {{ SC_(8), SC_(-2.63005473949263794793894252481846872735603048746209894161304e-1), SC_(-6.2592196385493867337930535896112384727429648943468354107824e-1) }},
+    {{ SC_(10), SC_(-2.00206822837394014988932690390655469153293188870281771152324), SC_(-1.03149419288305394131135577090394111842419674974954814556566) }},
+    {{ SC_(12), SC_(-3.75657547148183448665727619229292826600184498265959462190765), SC_(-4.64618772165084615114942368232223928244776513257783538750069e-1) }},
+    {{ SC_(14), SC_(-2.18607298866449746336676170826760332409660672080246417053618), SC_(2.68013590382243362662307811119774265285514366982166433294117) }},
+    {{ SC_(16), SC_(1.11581141190449775795686138247983449981137168383149252022531e+1), SC_(1.23217838878409888775203809418978986778416592226511335025675e+1) }},
+    {{ SC_(18), SC_(5.84931262677998178289156041402296671530979143680381638191562e+1), SC_(3.97553361083014959321754079000709055545122878935196235102701e+1) }},
+    {{ SC_(20), SC_(2.05047232935155038425226145530332646677668905215366686198082e+2), SC_(1.22099905027335316558522379543540566720560866594437952849269e+2) }},
+  }};
+  check_hypergeometric_1f1_sweep(T(-3.5), T(2.75), z, 2u, sweep_negative_a_data);
+
+  static const boost::array<boost::array<T, 3>, 21> sweep_large_a_data = {{ // a = 7.5, b = 12.25
+    {{ SC_(-20), SC_(1.6380924850964620548777919414446923304509745250163767301933e-4), SC_(4.77564216952119102821639489526577342723557977977889003839834e-5) }},
+    {{ SC_(-18), SC_(2.99704918809914137770759974435374051922592123406441536649524e-4), SC_(9.37993076942575883997568912416863824019672336141605596053971e-5) }},
+    {{ SC_(-16), SC_(5.73829888897373201850174361619821219626519639317264778514364e-4), SC_(1.93391345527248763801797318334546238960676499560912708165586e-4) }},
+    {{ SC_(-14), SC_(1.15605327977136306928593481568089570796245364192349072400867e-3), SC_(4.20691452901945236046725555240958831402782399085703464406851e-4) }},
+    {{ SC_(-12), SC_(2.4649440193686609585750367087143367351534668244498930937809e-3), SC_(9.70571035686231697252600766827041873976267479680969287358697e-4) }},
+    {{ SC_(-10), SC_(5.5954401453806872988616390249610206395786212320714557869882e-3), SC_(2.3864505034299042937260741688521650330339210987348805221362e-3) }},
+    {{ SC_(-8), SC_(1.35975738389293560098438774985277683364145662738266109595383e-2), SC_(6.27971481386659012095410823975538162301999101537265507087716e-3) }},
+    {{ SC_(-6), SC_(3.55361979191381131251575894026716499499226192393026426374279e-2), SC_(1.77356062069783869218062223159947423348183748217120809660514e-2) }},
+    {{ SC_(-4), SC_(1.00172718874567758200765708197784547716586247011772491075258e-1), SC_(5.38259557323580562284884947692169230010468220803228367979641e-2) }},
+    {{ SC_(-2), SC_(3.04837696379670522172760166325102071782437888035242147432777e-1), SC_(1.75412700167832275657712970160182900332772430843267516399796e-1) }},
+    {{ SC_(0), SC_(1), SC_(6.12244897959183673469387755102040816326530612244897959183673e-1) }},
+    {{ SC_(2), SC_(3.5236919416875974429207247203544778224526106688133908642747), SC_(2.27922606271794896782924700832939969337869254572135399364292) }},
+    {{ SC_(4), SC_(1.32685450108936541645617062793180495228539373182051952515661e+1), SC_(9.00330478076960917140698900029880095516534359223908232040797) }},
+    {{ SC_(6), SC_(5.30677756673768131599495264707528079911230901089288422171774e+1), SC_(3.75237720153932696795003372570729553415969894675237036958081e+1) }},
+    {{ SC_(8), SC_(2.23996830455118591567980686352129875223197514188429685553249e+2), SC_(1.64066269011341393547923689933524678680718926835505529186378e+2) }},
+    {{ SC_(10), SC_(9.91633702950656405346303617991164574923881591268940777580632e+2), SC_(7.48476755933529317526884160270678190191459596494118741599894e+2) }},
+    {{ SC_(12), SC_(4.57780072627930767806802103876667606934113510159052148797912e+3), SC_(3.54504433582809004260600902291858130828659481756431753735826e+3) }},
+    {{ SC_(14), SC_(2.19240590360685771401207425112553156678578032968280140747713e+4), SC_(1.73548971379910030857743716617194166763881365335559649584947e+4) }},
+    {{ SC_(16), SC_(1.08438905870537349090455874189331126118474919305085365485918e+5), SC_(8.7476232301854439742975145541644222207360699941649618040852e+4) }},
+    {{ SC_(18), SC_(5.51769315911882774232574965707348342988260312013517403991331e+5), SC_(4.52438932576405112011502566560841978453064666186045950612955e+5) }},
+    {{ SC_(20), SC_(2.87863583956264214829072875444244406050402140878056305210342e+6), SC_(2.3942351507527721798120193507653842862840980652106395377916e+6) }},
+  }};
+  check_hypergeometric_1f1_sweep(T(7.5), T(12.25), unsorted, 1u, sweep_large_a_data);
+
+  static const boost::array<boost::array<T, 3>, 21> sweep_polynomial_data = {{ // a = -6, b = 4.5
+    {{ SC_(-20), SC_(5.78277109669369731289235933198781495995118286139957966583354e+3), SC_(-1.23767772509568175202850125450744645791085419568391704614615e+3) }},
+    {{ SC_(-18), SC_(3.70602084911992032735066790794344973911537379029639091558596e+3), SC_(-8.57443039107435392265113627342729509912172450872141274618055e+2) }},
+    {{ SC_(-16), SC_(2.28709680387265526584412033328441997172647327446089055996177e+3), SC_(-5.76169943300593455392217002124122867156922884477064043627511e+2) }},
+    {{ SC_(-14), SC_(1.34910504922207708585417563745737120350123446098678296820712e+3), SC_(-3.73351390542721812071657272895662988542245508189780635601069e+2) }},
+    {{ SC_(-12), SC_(7.53111264586806382472017146939747558942605382233865206001429e+2), SC_(-2.31495423874371242792295423874371242792295423874371242792295e+2) }},
+    {{ SC_(-10), SC_(3.92347017848565836181935253142683483240758782554448189123112e+2), SC_(-1.35888698848451170432594581201392346903182816495509993962006e+2) }},
+    {{ SC_(-8), SC_(1.8688901798808919551953607681161860728424195916455978375483e+2), SC_(-7.43600058696033928232070646931328045879129470460739810585012e+1) }},
+    {{ SC_(-6), SC_(7.88113230422827946047760289246357357812466171599298534283054e+1), SC_(-3.70437925335758153095614395923993447213261454747522858977967e+1) }},
+    {{ SC_(-4), SC_(2.78105033826396055498222680885219584909987386767572526086458e+1), SC_(-1.61436859665961833144495683195373597850378036136550068438613e+1) }},
+    {{ SC_(-2), SC_(7.30376031490582574173905443255288456526846619725876691820964), SC_(-5.69601516474581490061366222356934431237836810592228548884896) }},
+    {{ SC_(0), SC_(1), SC_(-1.33333333333333333333333333333333333333333333333333333333333) }},
+    {{ SC_(2), SC_(-5.61373038153223911737843626388518029384902449917929794090785e-2), SC_(-4.79402262683996430126461086213408194832343439154584665420579e-2) }},
+    {{ SC_(4), SC_(3.27073224906042243503543813141336361150602636670748125856485e-2), SC_(4.45955145645548122328308086822018710563602204469077534093014e-2) }},
+    {{ SC_(6), SC_(6.55134339344865660655134339344865660655134339344865660655134e-3), SC_(-5.80859800674042160110271565379924513051448035968159807169095e-2) }},
+    {{ SC_(8), SC_(-8.90340252569354736537399076098766501243281429039942971831517e-2), SC_(-8.6581461194464290439522637665052525733640284723876055145405e-3) }},
+    {{ SC_(10), SC_(3.29267109452867966799855344746985613858678874158750319741032e-2), SC_(1.26369674357290456361663792004349279891075556710231632832252e-1) }},
+    {{ SC_(12), SC_(3.09619173396263179544913291043322003074325055749204356015502e-1), SC_(1.03129893841968145373718129136085792432541658547850498314895e-1) }},
+    {{ SC_(14), SC_(2.10200280169320416998435574286967475821964986051673358174906e-1), SC_(-2.63125660029684797486655071794390679839596248264978915133714e-1) }},
+    {{ SC_(16), SC_(-9.09485263045634562662426439516222797956544086575046327368309e-1), SC_(-8.61548083839105510932136319133223157990959848544987863873313e-1) }},
+    {{ SC_(18), SC_(-2.97923315075017861395570373898547273160276256251488449630864), SC_(-1.04921373775862939949627256128804116420215491422921763479039) }},
+    {{ SC_(20), SC_(-3.91385234419290146844326410889878382138444057948701911550209), SC_(5.85353415074777303879471062133600833291235768015953774467706e-1) }},
+  }};
+  check_hypergeometric_1f1_sweep(T(-6), T(4.5), z, 1u, sweep_polynomial_data);
+}
+
+// the paired seeds of the recurrences against the same seeds taken
+// one at a time: the plain series pair keeps the stopping test of each
+// sum and gives the same bits, the 13_3_8 pair shares its Bessel
+// functions and prefix and rounds differently
+template <class T>
+void check_hypergeometric_1f1_taylor_seeds(const T& a, const T& b, const T& a_neighbour, const T& b_neighbour, const T& z)
+{
+  const boost::math::policies::policy<> pol;
+
+  T neighbour = 0;
+  const T result = boost::math::detail::hypergeometric_1f1_generic_series_pair(a, b, a_neighbour, b_neighbour, z, neighbour, pol);
+
+  BOOST_CHECK_EQUAL(result, boost::math::detail::hypergeometric_1f1_generic_series(a, b, z, pol));
+  BOOST_CHECK_EQUAL(neighbour, boost::math::detail::hypergeometric_1f1_generic_series(a_neighbour, b_neighbour, z, pol));
+}
+
+template <class T>
+void check_hypergeometric_1f1_13_3_8_seeds(const T& a, const T& b, const T& z)
+{
+  const boost::math::policies::policy<> pol;
+  const T tolerance = 10 * boost::math::tools::epsilon<T>();
+
+  T neighbour = 0;
+  const T result = boost::math::detail::hypergeometric_1f1_13_3_8_series_pair(a, b, z, neighbour, pol);
+
+  BOOST_CHECK_CLOSE_FRACTION(result, boost::math::detail::hypergeometric_1f1_13_3_8_series(a, b, z, pol), tolerance);
+  BOOST_CHECK_CLOSE_FRACTION(neighbour, boost::math::detail::hypergeometric_1f1_13_3_8_series(a, T(b - 1), z, pol), tolerance);
+}
+
+template <class T>
+void test_hypergeometric_1f1_recurrence_seeds(T)
+{
+  check_hypergeometric_1f1_taylor_seeds(T(2.5), T(3.25), T(1.5), T(3.25), T(4));
+  check_hypergeometric_1f1_taylor_seeds(T(-0.25), T(5.5), T(-1.25), T(5.5), T(-3));
+  check_hypergeometric_1f1_taylor_seeds(T(0.75), T(-0.25), T(0.75), T(-1.25), T(2.5));
+
+  // seeds of rows of hypergeometric_1f1_recurrence_seeds_data
+  check_hypergeometric_1f1_13_3_8_seeds(T(-10.5), T(-0.25), T(10));
+  check_hypergeometric_1f1_13_3_8_seeds(T(-10.5), T(-0.25), T(30));
+  check_hypergeometric_1f1_13_3_8_seeds(T(-15.25), T(-0.5), T(30));
+  check_hypergeometric_1f1_13_3_8_seeds(T(-20.5), T(-0.25), T(30));
+  check_hypergeometric_1f1_13_3_8_seeds(T(-30.75), T(-0.75), T(30));
+}
+
 template <class T>
 void test_hypergeometric(T, const char* name)
 {
@@ -132,11 +633,186 @@ void test_hypergeometric(T, const char* name)
 
   do_test_hypergeometric_1f1<T>(pearson_1f1_data, name, "John Pearson dissertation: WolframAlpha Data");
 
+  // function values calculated with mpmath: terminating series for
+  // negative integer a and b < 0, which take the backward recurrence
+  // although they are not its minimal solution
+  static const boost::array<boost::array<T, 4>, 5> terminating_1f1_data = {{
+    {{ SC_(-12), SC_(-0.8847300000000000164135371960583142936229705810546875), SC_(59.51899999999999835154085303656756877899169921875), SC_(-2.9405676494548546091608850201329245837276945452375577215971e+14) }},
+    {{ SC_(-37), SC_(-1.4705999999999999072741729833069257438182830810546875), SC_(49.01650000000000062527760746888816356658935546875), SC_(7.83291222446633807687383284195672325683666606748217216417838e+13) }},
+    {{ SC_(-58), SC_(-1.74889999999999989910293152206577360630035400390625), SC_(42.53999999999999914734871708787977695465087890625), SC_(8.72381172179369803547545252920934523094275941318537260963713e+11) }},
+    {{ SC_(-13), SC_(-1.510499999999999953814722175593487918376922607421875), SC_(19.8900000000000005684341886080801486968994140625), SC_(5.65652106237729230165320028032349962070783059931422074347757e+6) }},
+    {{ SC_(-31), SC_(-1.2112000000000000543565192856476642191410064697265625), SC_(37.77000000000000312638803734444081783294677734375), SC_(-1.28996107505896145586072263112939058025496567663847072327316e+11) }},
+  }};
+
+  do_test_hypergeometric_1f1<T>(terminating_1f1_data, name, "Terminating series by backward recurrence: mpmath Data");
+
+  // function values calculated with mpmath: the recurrence on negative b,
+  // started from 13_3_8 seeds at b and b - 1 evaluated as a pair
+  static const boost::array<boost::array<T, 4>, 7> hypergeometric_1f1_recurrence_seeds_data = {{
+    {{ SC_(-10.5), SC_(-25.25), SC_(10), SC_(4.00202729185096487410184726503774618580101662134843523200606e+1) }},
+    {{ SC_(-10.5), SC_(-25.25), SC_(30), SC_(-1.76833336618892768204362349724580664942973461662200164490414e+14) }},
+    {{ SC_(-10.5), SC_(-40.5), SC_(30), SC_(9.3207720550677977622478481725752331069619935328149465211217e+11) }},
+    {{ SC_(-15.25), SC_(-40.5), SC_(30), SC_(-1.06525125103173617417558698591039902118043924736214091475404e+9) }},
+    {{ SC_(-15.25), SC_(-50.25), SC_(30), SC_(-1.80248915302493886027975647246441685827747193562404804703856e+6) }},
+    {{ SC_(-20.5), SC_(-50.25), SC_(30), SC_(3.6477581282213859019323230453952653740947650065627764600766e+4) }},
+    {{ SC_(-30.75), SC_(-70.75), SC_(30), SC_(1.02949259112584895072036795687885762430615832188181358396114e+5) }},
+  }};
+
+  do_test_hypergeometric_1f1<T>(hypergeometric_1f1_recurrence_seeds_data, name, "Recurrence on negative b from paired seeds: mpmath Data");
+  test_hypergeometric_1f1_recurrence_seeds(T(0));
+
+  // dM/dz and d2M/dz2 calculated with mpmath as a / b M(a + 1, b + 1, z)
+  // and a (a + 1) / (b (b + 1)) M(a + 2, b + 2, z), one or more points
+  // in each region of hypergeometric_1f1_and_derivatives
+  static const boost::array<boost::array<T, 5>, 20> hypergeometric_1f1_derivatives_data = {{
+    {{ SC_(0.5), SC_(1.5), SC_(0.25), SC_(3.8810241664099407349716061049680623250936931604718542028985e-1), SC_(2.39436333529518527163877473144035521616345834279813656695914e-1) }},
+    {{ SC_(2.25), SC_(3.5), SC_(-0.75), SC_(3.77987813203328292315182630420463197442812404622732129544152e-1), SC_(2.62127928360487034677501075300652832492818830696229524483942e-1) }},
+    {{ SC_(1), SC_(1), SC_(3), SC_(2.00855369231876677409285296545817178969879078385541501443789e+1), SC_(2.00855369231876677409285296545817178969879078385541501443789e+1) }},
+    {{ SC_(3.5), SC_(2.5), SC_(1.5), SC_(8.9633781406761296452041109202385516380114997367393341135453), SC_(1.07560537688113555742449331042862619656137996840872009362544e+1) }},
+    {{ SC_(0.75), SC_(2.5), SC_(60), SC_(9.36685553833674707474587849638891289556435630866755246813749e+22), SC_(9.09718909224936644863475984726493445394950561582037358423556e+22) }},
+    {{ SC_(1.25), SC_(3.75), SC_(-70), SC_(2.79457742347363944056778692362958947412784103923211810571153e-4), SC_(8.78522212275336114854428007108724720138263723516435940602416e-6) }},
+    {{ SC_(-2.5), SC_(400), SC_(3.5), SC_(-6.16835168069582742279456708889544614717848500193777493231632e-3), SC_(2.32770559506077971495270062588926283134178984647152063151241e-5) }},
+    {{ SC_(1.5), SC_(300), SC_(-2), SC_(4.91789665171314221098344583123261001124655278729252188468827e-3), SC_(4.05797891849570017443053879987510197861158902833794698636769e-5) }},
+    {{ SC_(1), SC_(3.5), SC_(-8), SC_(2.59506123767835480317635593604735046885300104910392360706786e-2), SC_(5.07061363669458381644453949873080540037807955791278413058347e-3) }},
+    {{ SC_(1), SC_(-4.5), SC_(-12.5), SC_(-1.57326257973617370440270694588217955246624545682471284954608e-1), SC_(-1.53564825354554927331631453095712120368933455678571530917196e-2) }},
+    {{ SC_(-7), SC_(2.5), SC_(6.5), SC_(3.93329372152901564666270548623489799960388195682313329372153e-1), SC_(2.0991087344028520499108734402852049910873440285204991087344e-1) }},
+    {{ SC_(-12), SC_(4.25), SC_(0.5), SC_(-8.31474083335704121617414421720224626185587800643580088014849e-1), SC_(2.43579250124736550137995638791655418692769975154768495086243) }},
+    {{ SC_(-3.5), SC_(9.25), SC_(2.5), SC_(-1.84772422978698707369469526625679141956289183550348473277016e-1), SC_(6.31473487051221682900653517310003663521909539187010444247302e-2) }},
+    {{ SC_(-2.25), SC_(-5.5), SC_(3), SC_(1.68535009430558614975586578786986384430649880713263066920144e-1), SC_(-1.43687057989859780459748846467208089491269502778081422084959) }},
+    {{ SC_(4.5), SC_(-2.75), SC_(-3.5), SC_(-1.30074571108955048992385337810973304017206097753589715903485e+1), SC_(-1.19917412818834278966111862037492143183637002171039817833653e+1) }},
+    {{ SC_(-6.5), SC_(1.5), SC_(5), SC_(4.10118816845605110657947249906061659637259394875712157724481e-1), SC_(1.34563870942325822196635558782456197506513744359212761934574) }},
+    {{ SC_(0.125), SC_(0.375), SC_(12), SC_(2.74380027999719938420975970380731276603432531746415656825334e+4), SC_(2.68730349967912096022798547384083060158699669738298371747918e+4) }},
+    {{ SC_(2), SC_(5), SC_(0), SC_(4.0e-1), SC_(2.0e-1) }},
+    {{ SC_(-5), SC_(0.5), SC_(-2.5), SC_(-2.30899470899470899470899470899470899470899470899470899470899e+2), SC_(1.74391534391534391534391534391534391534391534391534391534392e+2) }},
+    {{ SC_(-10.625), SC_(39.25), SC_(59), SC_(2.18750718735007744011068242073902002383726372889836539747382e-6), SC_(4.85468594204747755230642831873363822451148160839390383217814e-6) }},
+  }};
+
+  do_test_hypergeometric_1f1_derivatives<T>(hypergeometric_1f1_derivatives_data, name, "Derivatives in z: mpmath Data");
+
+  // dM/da and dM/db calculated with mpmath by numerical differentiation,
+  // one or more points in each region of hypergeometric_1f1_and_parameter_derivatives;
+  // dM/da does not terminate with M for non-positive integer a
+  static const boost::array<boost::array<T, 5>, 22> hypergeometric_1f1_parameter_derivatives_data = {{
+    {{ SC_(0.5), SC_(1.5), SC_(0.25), SC_(1.84537578244232893476970163986296321814601114e-1), SC_(-6.27551669939225641684818657840098177389720306e-2) }},
+    {{ SC_(2.25), SC_(3.5), SC_(-0.75), SC_(-1.37050918456982976704717253006865785333791135e-1), SC_(8.60213908473908576409932437784266050653328133e-2) }},
+    {{ SC_(1), SC_(1), SC_(3), SC_(3.39219879785884024725632586596741114180968968e+1), SC_(-3.39219879785884024725632586596741114180968968e+1) }},
+    {{ SC_(3.5), SC_(2.5), SC_(1.5), SC_(3.20887122159783861464597242474987794857695537), SC_(-4.28447659847897417207046573517850414513833533) }},
+    {{ SC_(0.75), SC_(2.5), SC_(60), SC_(4.96552024610793554134579603556412429445610173e+23), SC_(-3.26814909249554607342543793716847901278634178e+23) }},
+    {{ SC_(1.25), SC_(3.75), SC_(-70), SC_(-5.67750510339896024503314936371521089692222053e-2), SC_(7.38420134119529769491616836945086304513731304e-3) }},
+    {{ SC_(-2.5), SC_(400), SC_(3.5), SC_(8.59789432004464616900467756215178869191904052e-3), SC_(5.39739660652280562990217283144061851697305957e-5) }},
+    {{ SC_(1.5), SC_(300), SC_(-2), SC_(-6.57893349194118043653254564900652019271496223e-3), SC_(3.27868765009499800540848064525949606514068022e-5) }},
+    {{ SC_(1), SC_(3.5), SC_(-8), SC_(-3.78246347975479676468362841424978406544698929e-1), SC_(7.39674211040462045531208236246450147690159285e-2) }},
+    {{ SC_(2.5), SC_(4.25), SC_(-6), SC_(-8.85475320532953660146972143140613853661269367e-2), SC_(4.24218056946494857123240876467646294289953007e-2) }},
+    {{ SC_(-7), SC_(2.5), SC_(6.5), SC_(-3.45189863283829928605511961824207374829533508e-1), SC_(-4.29283878153913155436046232293429924710600974e-1) }},
+    {{ SC_(-12), SC_(4.25), SC_(0.5), SC_(3.24823817890994448342738204512780673899868997e-2), SC_(1.13029407939276203568686779476078669712065263e-1) }},
+    {{ SC_(-3), SC_(1.5), SC_(2), SC_(-2.8909392521564963317540309891770926377594671e-1), SC_(7.76417233560090702947845804988662131519274376e-2) }},
+    {{ SC_(-3.5), SC_(9.25), SC_(2.5), SC_(1.13085800184125180379519661550043266762306227e-1), SC_(5.20738652469143313076950918422091733403168098e-2) }},
+    {{ SC_(-6.5), SC_(1.5), SC_(5), SC_(-6.42575413624363997852929580670771550335475006e-1), SC_(7.10792151613018117735606781454631817876160911e-1) }},
+    {{ SC_(4.5), SC_(-2.75), SC_(-3.5), SC_(1.10319690874815419288137774239033866489839386e+1), SC_(-5.4697280649132650003642201698728863978406205e+1) }},
+    {{ SC_(0), SC_(2.5), SC_(3), SC_(2.08715851195995362538390212982425934764466281), SC_(0) }},
+    {{ SC_(0.125), SC_(0.375), SC_(12), SC_(3.02292702277664409910021647562178549992047309e+5), SC_(-1.44780469280724649262477984221313157925820047e+5) }},
+    {{ SC_(-5), SC_(0.5), SC_(-2.5), SC_(-1.53760729177273262722113984767479846255854542e+2), SC_(-6.3937179810195683211556227429243302259175275e+2) }},
+    {{ SC_(6.5), SC_(1.25), SC_(4), SC_(8.91264892670442600045672582447578042316890387e+3), SC_(-2.64484791360945848603309002828655062035150501e+4) }},
+    {{ SC_(-27.75), SC_(-4.625), SC_(35.25), SC_(-6.95180565232183473778299249093726915289175327e+13), SC_(-7.04197405694249784806750072360423143518722893e+13) }},
+    {{ SC_(-21.25), SC_(-70.5), SC_(-0.9375), SC_(1.00376869579672342975072742649256648165203662e-2), SC_(-3.04007105363171748278718222075689000809094156e-3) }},
+  }};
+
+  do_test_hypergeometric_1f1_parameter_derivatives<T>(hypergeometric_1f1_parameter_derivatives_data, name, "Derivatives in a and b: mpmath Data");
+
+  T da, db;
+  BOOST_CHECK_THROW(boost::math::hypergeometric_1f1_and_parameter_derivatives(T(1.5), T(-2), T(1), &da, &db), std::domain_error);
+
+  // 1F2 calculated with mpmath, in the region of its large argument
+  // expansion: three points on either side of the origin
+  static const boost::array<boost::array<T, 5>, 6> hypergeometric_1f2_asym_data = {{
+    {{ SC_(1.5), SC_(2.25), SC_(3.5), SC_(-300), SC_(5.45334007676066434343145821648566094266512000998212334823645e-4) }},
+    {{ SC_(0.75), SC_(1.5), SC_(2.5), SC_(-400), SC_(1.16365203785613111733495668247762590662158014431083463279944e-2) }},
+    {{ SC_(0.5), SC_(3.5), SC_(1), SC_(-350), SC_(5.02153245490428770507773664038146990904029176267786715940524e-2) }},
+    {{ SC_(1.5), SC_(2.5), SC_(3.25), SC_(200), SC_(9.44493111385103437161982380826609193270500284828201933204543e+7) }},
+    {{ SC_(0.5), SC_(1.25), SC_(2.75), SC_(300), SC_(5.00860628363034987147088696149187268060778680291667911285202e+10) }},
+    {{ SC_(3.5), SC_(4.5), SC_(2.25), SC_(150), SC_(4.07737307083923894193425527419331177165481049853355200303869e+7) }},
+  }};
+
+  do_test_hypergeometric_1f2<T>(hypergeometric_1f2_asym_data, name, "1F2 large argument expansion: mpmath Data");
+
+  // closed forms calculated with mpmath: each family of
+  // detail/hypergeometric_closed_forms.hpp, the 1F1 families
+  // also after Kummer's transformation, the 2F1 families also
+  // with the upper parameters swapped
+  static const boost::array<boost::array<T, 3>, 4> hypergeometric_0f1_closed_form_data = {{
+    {{ SC_(0.5), SC_(6.25), SC_(7.42099485247878444441061080444877140238682585894531720660916e+1) }},
+    {{ SC_(0.5), SC_(-12.5), SC_(7.05347906308442311514564496841340738419259987602806006568952e-1) }},
+    {{ SC_(1.5), SC_(20.5), SC_(4.72897337893781676617661557137961385920402498350581656452282e+2) }},
+    {{ SC_(1.5), SC_(-7.75), SC_(-1.17809441652061825637257753151386095650162781753959269839793e-1) }},
+  }};
+
+  do_test_hypergeometric_0f1<T>(hypergeometric_0f1_closed_form_data, name, "0F1 closed forms: mpmath Data");
+
+  // 0F1 calculated with mpmath in the region of the Bessel route,
+  // from either side of the crossover for negative z on to large b,
+  // where the prefix Gamma(b) z^((1 - b) / 2) is taken by its logarithm
+  static const boost::array<boost::array<T, 3>, 11> hypergeometric_0f1_bessel_data = {{
+    {{ SC_(0.25), SC_(-3.5), SC_(-1.23114718230729770938673644724851234198458741924629438540448) }},
+    {{ SC_(4.75), SC_(-5), SC_(3.08340625373230310764907295822451070368676491962035629478024e-1) }},
+    {{ SC_(2.25), SC_(-50), SC_(8.96951792520104310384632072272250103990976862469887312367305e-3) }},
+    {{ SC_(-3.75), SC_(-120), SC_(-2.73001655795372690212567763594904226951664132756542642271937e+3) }},
+    {{ SC_(10.5), SC_(-400), SC_(6.07169593507918356987487051549705311889890725524951746145334e-8) }},
+    {{ SC_(35.125), SC_(-2500), SC_(1.35008126916476045411235665882568703133623483497734768328989e-21) }},
+    {{ SC_(170.5), SC_(-100000), SC_(9.00316430682312888346564838282855149719104213717843101082252e-121) }},
+    {{ SC_(250.25), SC_(-200000), SC_(-3.17130993982130561865535792513686035293604001126214672488273e-172) }},
+    {{ SC_(300), SC_(300000), SC_(2.42154932712799504521568430396054867782861758177098426146518e+249) }},
+    {{ SC_(500), SC_(400000), SC_(6.85047194272951229247054768005412194692539941658855925685608e+238) }},
+    {{ SC_(700.5), SC_(500000), SC_(1.71305741154470887522227313706785862136236508458998298896613e+233) }},
+  }};
+
+  do_test_hypergeometric_0f1<T>(hypergeometric_0f1_bessel_data, name, "0F1 Bessel route: mpmath Data");
+
+  static const boost::array<boost::array<T, 4>, 9> hypergeometric_1f1_closed_form_data = {{
+    {{ SC_(0.5), SC_(1.5), SC_(-2.25), SC_(5.70792262416600707441599615381536388098835522669617534905926e-1) }},
+    {{ SC_(0.5), SC_(1.5), SC_(-30), SC_(1.61802159379640069690513193060088106837984283534524388277113e-1) }},
+    {{ SC_(2.5), SC_(3.5), SC_(-4.75), SC_(6.14533899773885513834333576693875528432941737344670940644634e-2) }},
+    {{ SC_(7.25), SC_(8.25), SC_(-0.625), SC_(5.7872825260330784984849914064104359972381990944520910720461e-1) }},
+    {{ SC_(1.75), SC_(3.5), SC_(5.5), SC_(3.32311515015464531699287437844460522220285188192802975714762e+1) }},
+    {{ SC_(12.5), SC_(25), SC_(40), SC_(2.81497554612256131560842822754989854220201712005016395666893e+11) }},
+    {{ SC_(1), SC_(1.5), SC_(3.25), SC_(1.25415133350800653435864875725419053481370819061638341200339e+1) }},
+    {{ SC_(1), SC_(4.5), SC_(6), SC_(7.97727404711985576317042700581001681423095146314424756782898) }},
+    {{ SC_(3.25), SC_(6.5), SC_(-9), SC_(3.69466927928478164193192693464551996204276925225467335287747e-2) }},
+  }};
+
+  do_test_hypergeometric_1f1<T>(hypergeometric_1f1_closed_form_data, name, "1F1 closed forms: mpmath Data");
+
+  static const boost::array<boost::array<T, 5>, 9> hypergeometric_2f1_closed_form_data = {{
+    {{ SC_(2.5), SC_(1.25), SC_(1.25), SC_(-0.75), SC_(2.46833941557046352466623044071301264206204938363377276302585e-1) }},
+    {{ SC_(1), SC_(1), SC_(2), SC_(0.5), SC_(1.38629436111989061883446424291635313615100026872051050824136) }},
+    {{ SC_(1), SC_(1), SC_(2), SC_(-3.5), SC_(4.2973639907893544953521667211053566891985170893864104267106e-1) }},
+    {{ SC_(0.5), SC_(1), SC_(1.5), SC_(0.25), SC_(1.09861228866810969139524523692252570464749055782274945173469) }},
+    {{ SC_(1), SC_(0.5), SC_(1.5), SC_(-6), SC_(4.83039230364496958092477822703107503096303643839448291413506e-1) }},
+    {{ SC_(0.5), SC_(0.5), SC_(1.5), SC_(0.8125), SC_(1.24581662450100947681637344400964721914550361068364068060796) }},
+    {{ SC_(0.5), SC_(0.5), SC_(1.5), SC_(-2.5), SC_(7.83577217617423511236510881231800174229148569030907193317111e-1) }},
+    {{ SC_(-7), SC_(8), SC_(1), SC_(0.375), SC_(-2.79918670654296875e-1) }},
+    {{ SC_(9), SC_(-8), SC_(1), SC_(0.9375), SC_(-3.691775337792932987213134765625e-1) }},
+  }};
+
+  do_test_hypergeometric_2f1<T>(hypergeometric_2f1_closed_form_data, name, "2F1 closed forms: mpmath Data");
+
 #include "hypergeometric_1f1_luke_rational_data.ipp"
   do_test_hypergeometric_1f1<T>(hypergeometric_1f1_luke_rational_data, name, "Random positive data with b >= (10 * a) (rational case)");
+  do_test_hypergeometric_1f1_compensated<T>(hypergeometric_1f1_luke_rational_data, name, "Random positive data with b >= (10 * a) (rational case, compensated)");
 #include "hypergeometric_1f1_luke_pade_moderate_data.ipp"
   do_test_hypergeometric_1f1<T>(hypergeometric_1f1_luke_pade_moderate_data, name, "Random data with a == 1 (pade case)");
+  do_test_hypergeometric_1f1_compensated<T>(hypergeometric_1f1_luke_pade_moderate_data, name, "Random data with a == 1 (pade case, compensated)");
 #include "hypergeometric_1f1_moderate_data.ipp"
   do_test_hypergeometric_1f1<T>(hypergeometric_1f1_moderate_data, name, "Random moderate data");
+
+  test_hypergeometric_1f1_grid(T(0));
+  test_hypergeometric_1f1_sweep(T(0));
+
+  // large data sets are kept out of the source,
+  // see boost/math/tools/binary_test_data.hpp
+  if (const char* path = std::getenv("BOOST_MATH_HYPERGEOMETRIC_1F1_DATA"))
+  {
+    const boost::math::tools::binary_test_data<T, 4> hypergeometric_1f1_binary_data(path);
+    do_test_hypergeometric_1f1<T>(hypergeometric_1f1_binary_data, name, path);
+  }
 }
 
@@ -0,0 +1,159 @@
+//  (C) Copyright Anton Bikineev 2014.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/math/special_functions/hypergeometric.hpp>
+#include <boost/math/tools/chebyshev.hpp>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+//
+// DESCRIPTION:
+// ~~~~~~~~~~~~
+//
+// This file tests tools::make_piecewise_chebyshev and
+// hypergeometric_1f1_chebyshev: that the interpolant meets the
+// tolerance it reports between the points it was checked at, that
+// the builder keeps to max_fits, and that a tolerance the oracle
+// can't support is reported as an evaluation error.
+//
+
+// f(x) = exp(x), counting the calls
+template <class T>
+struct counted_exp
+{
+  explicit counted_exp(std::size_t* calls): calls(calls)
+  {
+  }
+
+  T operator()(const T& x) const
+  {
+    ++*calls;
+    return exp(x);
+  }
+
+private:
+  std::size_t* calls;
+};
+
+// f(x) = 1 + |x - 1/3|, which no polynomial piece fits to
+// a small tolerance unless it ends at the kink
+template <class T>
+struct counted_kink
+{
+  explicit counted_kink(std::size_t* calls): calls(calls)
+  {
+  }
+
+  T operator()(const T& x) const
+  {
+    ++*calls;
+    return 1 + fabs(x - T(1) / 3);
+  }
+
+private:
+  std::size_t* calls;
+};
+
+template <class T>
+void test_make_piecewise_chebyshev(T)
+{
+  using namespace boost::math::tools;
+
+  // the builder checks halfway between the nodes, the error elsewhere
+  // is allowed twice the tolerance
+  {
+    const T tolerance = T(1e-12);
+    std::size_t calls = 0u;
+    const piecewise_chebyshev<T> p = make_piecewise_chebyshev(counted_exp<T>(&calls), T(-1), T(3), tolerance);
+
+    BOOST_CHECK(p.max_error() <= tolerance);
+    BOOST_CHECK_EQUAL(p.lower(), T(-1));
+    BOOST_CHECK_EQUAL(p.upper(), T(3));
+
+    std::vector<T> xs, values(1001u);
+    for (unsigned k = 0; k <= 1000u; ++k)
+      xs.push_back(T(-1) + (4 * T(k)) / 1000);
+    p.evaluate(xs.begin(), xs.end(), values.begin());
+
+    for (unsigned k = 0; k < xs.size(); ++k)
+    {
+      BOOST_CHECK_CLOSE_FRACTION(p(xs[k]), T(exp(xs[k])), 2 * tolerance);
+      BOOST_CHECK_EQUAL(values[k], p(xs[k]));
+    }
+  }
+
+  // no more than max_fits pieces are fitted, each for 2 * max_degree + 3
+  // calls of f; the tolerance is then missed, and max_error() says so
+  {
+    const T tolerance = T(1e-14);
+    const unsigned max_degree = 8u;
+    const std::size_t max_fits = 7u;
+
+    std::size_t calls = 0u;
+    const piecewise_chebyshev<T> p = make_piecewise_chebyshev(counted_kink<T>(&calls), T(0), T(1), tolerance, max_degree, 16u, max_fits);
+
+    BOOST_CHECK(calls <= max_fits * (2u * max_degree + 3u));
+    BOOST_CHECK(p.size() <= max_fits);
+    BOOST_CHECK(p.max_error() > tolerance);
+  }
+}
+
+template <class T>
+void test_hypergeometric_1f1_chebyshev(T)
+{
+  using namespace boost::math::policies;
+
+  {
+    const T a = T(0.5), b = T(1.5);
+    const T tolerance = T(1e-13);
+    const boost::math::tools::piecewise_chebyshev<T> p = boost::math::hypergeometric_1f1_chebyshev(a, b, T(-5), T(5), tolerance);
+
+    BOOST_CHECK(p.max_error() <= tolerance);
+    for (unsigned k = 0; k <= 200u; ++k)
+    {
+      const T z = T(-5) + (10 * T(k)) / 200;
+      BOOST_CHECK_CLOSE_FRACTION(p(z), T(boost::math::hypergeometric_1f1(a, b, z)), 2 * tolerance);
+    }
+  }
+
+  // the oracle is noisy well above a few epsilon for large negative a,
+  // the tolerance, clamped to 8 epsilon, can't be met there
+  {
+    const T a = T(-40.5), b = T(1.5);
+    const T tolerance = boost::math::tools::epsilon<T>();
+
+    BOOST_CHECK_THROW(boost::math::hypergeometric_1f1_chebyshev(a, b, T(0), T(80), tolerance), boost::math::evaluation_error);
+
+    const boost::math::tools::piecewise_chebyshev<T> p = boost::math::hypergeometric_1f1_chebyshev(a, b, T(0), T(80), tolerance, policy<evaluation_error<ignore_error> >());
+    BOOST_CHECK(p.size() > 0u);
+    BOOST_CHECK(p.max_error() > 8 * tolerance);
+  }
+
+  BOOST_CHECK_THROW(boost::math::hypergeometric_1f1_chebyshev(T(0.5), T(1.5), T(1), T(1), T(1e-10)), std::domain_error);
+  BOOST_CHECK_THROW(boost::math::hypergeometric_1f1_chebyshev(T(0.5), T(-2), T(0), T(1), T(1e-10)), std::domain_error);
+}
+
+template <class T>
+void test_hypergeometric_chebyshev(T, const char* type_name)
+{
+  std::cout << "Testing the Chebyshev interpolants with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  test_make_piecewise_chebyshev(T(0));
+  test_hypergeometric_1f1_chebyshev(T(0));
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+  test_hypergeometric_chebyshev(0.1, "double");
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+  test_hypergeometric_chebyshev(0.1L, "long double");
+#endif
+}
@@ -0,0 +1,137 @@
+//  (C) Copyright Anton Bikineev 2014.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/math/special_functions/hypergeometric.hpp>
+#include <boost/math/special_functions/legendre.hpp>
+#include <boost/array.hpp>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "table_type.hpp"
+
+#ifndef SC_
+#  define SC_(x) static_cast<typename table_type<T>::type>(BOOST_JOIN(x, L))
+#endif
+
+//
+// DESCRIPTION:
+// ~~~~~~~~~~~~
+//
+// This file tests hypergeometric_1f1_polynomial and
+// hypergeometric_2f1_polynomial against hypergeometric_1f1, against
+// values calculated with mpmath, and against the closed forms of
+// 1F1(-2; b; z) and of the Legendre polynomials. The error of a
+// polynomial at z is allowed to grow with its condition_number(z).
+//
+
+template <class T>
+void check_polynomial(const boost::math::tools::scaled_polynomial<T>& p, const T& z, const T& expected)
+{
+  const T tolerance = 20 * p.condition_number(z) * boost::math::tools::epsilon<T>();
+  BOOST_CHECK_CLOSE_FRACTION(p(z), expected, tolerance);
+}
+
+template <class T>
+void test_hypergeometric_1f1_polynomial(T)
+{
+  static const T bs[] = { T(-7.5), T(0.25), T(1), T(3.75), T(40.5) };
+  static const T zs[] = { T(-12.5), T(-1), T(0.0625), T(0.75), T(3), T(17.5) };
+
+  for (int n = 0; n <= 30; n += 3)
+  {
+    for (unsigned j = 0; j < sizeof(bs) / sizeof(bs[0]); ++j)
+    {
+      const boost::math::tools::scaled_polynomial<T> p = boost::math::hypergeometric_1f1_polynomial(T(-n), bs[j]);
+      BOOST_CHECK_EQUAL(p.degree(), static_cast<std::size_t>(n));
+
+      // the many point evaluation takes Horner's rule, the single
+      // point one Estrin's scheme: both are held to the same bound
+      std::vector<T> values(sizeof(zs) / sizeof(zs[0]));
+      p.evaluate(zs, zs + sizeof(zs) / sizeof(zs[0]), values.begin());
+
+      for (unsigned k = 0; k < sizeof(zs) / sizeof(zs[0]); ++k)
+      {
+        const T expected = boost::math::hypergeometric_1f1(T(-n), bs[j], zs[k]);
+        check_polynomial(p, zs[k], expected);
+        BOOST_CHECK_CLOSE_FRACTION(values[k], expected, T(20 * p.condition_number(zs[k]) * boost::math::tools::epsilon<T>()));
+      }
+    }
+  }
+
+  // 1F1(-2; b; z) = 1 - 2z / b + z^2 / (b (b + 1))
+  for (unsigned j = 0; j < sizeof(bs) / sizeof(bs[0]); ++j)
+  {
+    const boost::math::tools::scaled_polynomial<T> p = boost::math::hypergeometric_1f1_polynomial(T(-2), bs[j]);
+    for (unsigned k = 0; k < sizeof(zs) / sizeof(zs[0]); ++k)
+    {
+      const T z = zs[k], b = bs[j];
+      check_polynomial(p, z, T((1 - ((2 * z) / b)) + ((z * z) / (b * (b + 1)))));
+    }
+  }
+
+  T a = T(-2.5);
+  BOOST_CHECK_THROW(boost::math::hypergeometric_1f1_polynomial(a, T(1.5)), std::domain_error);
+  a = -5;
+  BOOST_CHECK_THROW(boost::math::hypergeometric_1f1_polynomial(a, T(-2)), std::domain_error);
+}
+
+template <class T>
+void test_hypergeometric_2f1_polynomial(T)
+{
+  // values calculated with mpmath: either upper parameter may terminate
+  // the series, and the degree is the smaller one when both do
+  static const boost::array<boost::array<T, 5>, 10> hypergeometric_2f1_data = {{
+    {{ SC_(-3), SC_(1.5), SC_(2.5), SC_(0.5), SC_(3.79761904761904761904761904761904761904761904761904761904762e-1) }},
+    {{ SC_(-5), SC_(-2.25), SC_(3.5), SC_(-1.5), SC_(-1.02882469093406593406593406593406593406593406593406593406593e-1) }},
+    {{ SC_(2.5), SC_(-4), SC_(0.75), SC_(0.25), SC_(-4.52651515151515151515151515151515151515151515151515151515152e-1) }},
+    {{ SC_(-7), SC_(3.25), SC_(-8.5), SC_(0.875), SC_(2.19295349061183644701027827679367201426024955436720142602496e+1) }},
+    {{ SC_(-10), SC_(10.5), SC_(1), SC_(0.3125), SC_(8.53258627710714763481281153190138866193592548370361328125e-2) }},
+    {{ SC_(-6), SC_(-6), SC_(1.25), SC_(-3), SC_(7.89367886231415643180349062702003878474466709760827407886231e+2) }},
+    {{ SC_(-12), SC_(2), SC_(5.5), SC_(0.0625), SC_(7.66108020027260358349104466599527438540170264790327674096017e-1) }},
+    {{ SC_(4.5), SC_(-2), SC_(-5.5), SC_(7), SC_(6.14545454545454545454545454545454545454545454545454545454545e+1) }},
+    {{ SC_(-20), SC_(21), SC_(1), SC_(0.375), SC_(8.09551940373946406215299731456980225630104541778564453125e-2) }},
+    {{ SC_(-4), SC_(0.5), SC_(1.5), SC_(-12.5), SC_(4.03391170634920634920634920634920634920634920634920634920635e+3) }},
+  }};
+
+  for (unsigned i = 0; i < hypergeometric_2f1_data.size(); ++i)
+  {
+    const boost::array<T, 5>& row = hypergeometric_2f1_data[i];
+    check_polynomial(boost::math::hypergeometric_2f1_polynomial(row[0], row[1], row[2]), row[3], row[4]);
+  }
+
+  BOOST_CHECK_EQUAL(boost::math::hypergeometric_2f1_polynomial(T(-6), T(-9), T(1.25)).degree(), 6u);
+
+  // P(n, x) = 2F1(-n, n + 1; 1; (1 - x) / 2)
+  static const T xs[] = { T(-0.875), T(-0.25), T(0.125), T(0.5), T(0.96875) };
+  for (int n = 1; n <= 25; n += 4)
+  {
+    const boost::math::tools::scaled_polynomial<T> p = boost::math::hypergeometric_2f1_polynomial(T(-n), T(n + 1), T(1));
+    for (unsigned k = 0; k < sizeof(xs) / sizeof(xs[0]); ++k)
+      check_polynomial(p, T((1 - xs[k]) / 2), T(boost::math::legendre_p(n, xs[k])));
+  }
+
+  BOOST_CHECK_THROW(boost::math::hypergeometric_2f1_polynomial(T(1.5), T(2.5), T(3)), std::domain_error);
+}
+
+template <class T>
+void test_hypergeometric_polynomial(T, const char* type_name)
+{
+  std::cout << "Testing the hypergeometric polynomials with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  test_hypergeometric_1f1_polynomial(T(0));
+  test_hypergeometric_2f1_polynomial(T(0));
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+  test_hypergeometric_polynomial(0.1, "double");
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+  test_hypergeometric_polynomial(0.1L, "long double");
+#endif
+}
@@ -0,0 +1,235 @@
+//  (C) Copyright John Maddock 2007.
+//  (C) Copyright Anton Bikineev 2014.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/math/concepts/real_concept.hpp>
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/math/special_functions/math_fwd.hpp>
+#include <boost/math/special_functions/hypergeometric.hpp>
+#include <boost/array.hpp>
+#include <stdexcept>
+#include "functor.hpp"
+
+#include "handle_test_result.hpp"
+#include "table_type.hpp"
+
+#ifndef SC_
+#  define SC_(x) static_cast<typename table_type<T>::type>(BOOST_JOIN(x, L))
+#endif
+
+template <class T>
+T hypergeometric_u_from_pair(T a, T b, T z)
+{
+  T u = 0;
+  boost::math::hypergeometric_1f1_and_u(a, b, z, &u);
+  return u;
+}
+
+template <class Real, class T>
+void do_test_hypergeometric_u(const T& data, const char* type_name, const char* test_name)
+{
+  typedef Real                   value_type;
+
+  typedef value_type (*pg)(value_type, value_type, value_type);
+#if defined(BOOST_MATH_NO_DEDUCED_FUNCTION_POINTERS)
+  pg funcp = boost::math::hypergeometric_u<value_type, value_type, value_type>;
+#else
+  pg funcp = boost::math::hypergeometric_u;
+#endif
+
+  boost::math::tools::test_result<value_type> result;
+
+  std::cout << "Testing " << test_name << " with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  //
+  // test hypergeometric_u against data:
+  //
+  result = boost::math::tools::test_hetero<Real>(
+    data,
+    bind_func<Real>(funcp, 0, 1, 2),
+    extract_result<Real>(3));
+  handle_test_result(result, data[result.worst()], result.worst(), type_name, "boost::math::hypergeometric_u", test_name);
+  std::cout << std::endl;
+}
+
+template <class Real, class T>
+void do_test_hypergeometric_1f1_and_u(const T& data, const char* type_name, const char* test_name)
+{
+  typedef Real                   value_type;
+
+  typedef value_type (*pg)(value_type, value_type, value_type);
+  pg funcp = hypergeometric_u_from_pair<value_type>;
+
+  boost::math::tools::test_result<value_type> result;
+
+  std::cout << "Testing " << test_name << " with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  //
+  // test U from hypergeometric_1f1_and_u against data:
+  //
+  result = boost::math::tools::test_hetero<Real>(
+    data,
+    bind_func<Real>(funcp, 0, 1, 2),
+    extract_result<Real>(3));
+  handle_test_result(result, data[result.worst()], result.worst(), type_name, "boost::math::hypergeometric_1f1_and_u", test_name);
+  std::cout << std::endl;
+}
+
+// U(a, a + 1, z) = z^-a, U(-1, b, z) = z - b,
+// U(-2, b, z) = z^2 - 2(b + 1)z + b(b + 1), and Kummer's transformation
+// U(a, b, z) = z^(1 - b) U(a - b + 1, 2 - b, z) from either side of b = 1
+template <class T>
+void test_hypergeometric_u_closed_forms(T)
+{
+  BOOST_MATH_STD_USING // pow
+
+  const T tolerance = 500 * boost::math::tools::epsilon<T>();
+
+  static const T as[] = { T(-2.75), T(-0.5), T(0.25), T(1), T(2.5), T(6.125) };
+  static const T bs[] = { T(-3.5), T(-1), T(0), T(0.5), T(1.75), T(4.25) };
+  static const T zs[] = { T(0.0625), T(0.75), T(2), T(9.5), T(40) };
+
+  for (unsigned i = 0; i < sizeof(as) / sizeof(as[0]); ++i)
+    for (unsigned k = 0; k < sizeof(zs) / sizeof(zs[0]); ++k)
+      BOOST_CHECK_CLOSE_FRACTION(boost::math::hypergeometric_u(as[i], T(as[i] + 1), zs[k]), T(pow(zs[k], -as[i])), tolerance);
+
+  for (unsigned j = 0; j < sizeof(bs) / sizeof(bs[0]); ++j)
+  {
+    for (unsigned k = 0; k < sizeof(zs) / sizeof(zs[0]); ++k)
+    {
+      const T b = bs[j], z = zs[k];
+
+      // away from the zeros of the polynomials
+      const T linear = z - b;
+      if (fabs(linear) > 0.25f)
+        BOOST_CHECK_CLOSE_FRACTION(boost::math::hypergeometric_u(T(-1), b, z), linear, tolerance);
+
+      const T quadratic = ((z * z) - ((2 * (b + 1)) * z)) + (b * (b + 1));
+      if (fabs(quadratic) > 0.25f)
+        BOOST_CHECK_CLOSE_FRACTION(boost::math::hypergeometric_u(T(-2), b, z), quadratic, tolerance);
+    }
+  }
+
+  for (unsigned i = 0; i < sizeof(as) / sizeof(as[0]); ++i)
+  {
+    for (unsigned j = 0; j < sizeof(bs) / sizeof(bs[0]); ++j)
+    {
+      const T a = as[i], b = bs[j], z = T(1.5);
+      BOOST_CHECK_CLOSE_FRACTION(boost::math::hypergeometric_u(a, b, z),
+                                 T(pow(z, 1 - b) * boost::math::hypergeometric_u(T((a - b) + 1), T(2 - b), z)),
+                                 tolerance);
+    }
+  }
+}
+
+// 1F1 and U of hypergeometric_1f1_and_u against the functions alone;
+// for non-positive integer b, where only U is defined, the pair raises
+// a domain error but still stores U under a policy that doesn't throw
+template <class T>
+void test_hypergeometric_1f1_and_u_consistency(T)
+{
+  typedef boost::math::policies::policy<boost::math::policies::domain_error<boost::math::policies::ignore_error> > ignore_domain_errors;
+
+  const T tolerance = 100 * boost::math::tools::epsilon<T>();
+
+  static const T as[] = { T(-2.75), T(0.25), T(1.5), T(3) };
+  static const T bs[] = { T(-2.5), T(0.5), T(1), T(3.25) };
+  static const T zs[] = { T(0.25), T(3), T(30), T(150) };
+
+  for (unsigned i = 0; i < sizeof(as) / sizeof(as[0]); ++i)
+  {
+    for (unsigned j = 0; j < sizeof(bs) / sizeof(bs[0]); ++j)
+    {
+      for (unsigned k = 0; k < sizeof(zs) / sizeof(zs[0]); ++k)
+      {
+        T u = 0;
+        const T m = boost::math::hypergeometric_1f1_and_u(as[i], bs[j], zs[k], &u);
+
+        BOOST_CHECK_CLOSE_FRACTION(m, boost::math::hypergeometric_1f1(as[i], bs[j], zs[k]), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(u, boost::math::hypergeometric_u(as[i], bs[j], zs[k]), tolerance);
+      }
+    }
+  }
+
+  T u = 0;
+  BOOST_CHECK_THROW(boost::math::hypergeometric_1f1_and_u(T(5), T(-1), T(2), &u), std::domain_error);
+
+  const T m = boost::math::hypergeometric_1f1_and_u(T(5), T(-1), T(2), &u, ignore_domain_errors());
+  BOOST_CHECK((boost::math::isnan)(m));
+  BOOST_CHECK_EQUAL(u, boost::math::hypergeometric_u(T(5), T(-1), T(2)));
+
+  BOOST_CHECK_THROW(boost::math::hypergeometric_u(T(1.5), T(2.5), T(-1)), std::domain_error);
+  BOOST_CHECK_THROW(boost::math::hypergeometric_1f1_and_u(T(1.5), T(2.5), T(0), &u), std::domain_error);
+}
+
+template <class T>
+void test_hypergeometric_u(T, const char* name)
+{
+  // function values calculated with mpmath: the Wronskian, the connection
+  // formula near z = 0, the asymptotic series, the polynomials for
+  // non-positive integer a, and Kummer's transformation for b < 1
+  static const boost::array<boost::array<T, 4>, 24> hypergeometric_u_data = {{
+    {{ SC_(0.5), SC_(1.5), SC_(2), SC_(7.0710678118654752440084436210484903928483593768847403658834e-1) }},
+    {{ SC_(1.25), SC_(2.5), SC_(0.75), SC_(1.78691301094948153738684517828744429931043870629620324243446) }},
+    {{ SC_(2.5), SC_(3.25), SC_(10), SC_(2.99757245646829316098629391811485790788854444059199268640678e-3) }},
+    {{ SC_(3), SC_(4.5), SC_(1), SC_(1.9565690683118240463939661674624703384022047329957233985816) }},
+    {{ SC_(0.25), SC_(1), SC_(3.5), SC_(7.20119652700636752318476115254994548647263238906516854534869e-1) }},
+    {{ SC_(1), SC_(1), SC_(1), SC_(5.96347362323194074341078499369279376074177860152548781573485e-1) }},
+    {{ SC_(7.5), SC_(2.25), SC_(4), SC_(1.35977812291700535447083314373156002424758377775080693520064e-7) }},
+    {{ SC_(0.75), SC_(5.5), SC_(30), SC_(8.59438701133687618624162925544845288852357886098428714606058e-2) }},
+    {{ SC_(1.5), SC_(2.5), SC_(150), SC_(5.44331053951817355154952016601309198214654995701482250762821e-4) }},
+    {{ SC_(4), SC_(1.5), SC_(200), SC_(5.83582849751650620568602476119986379805980538051836114887479e-10) }},
+    {{ SC_(-2.5), SC_(1.5), SC_(3), SC_(-4.97964607176052221889140823182938305496056510470484430566045) }},
+    {{ SC_(-0.75), SC_(3.25), SC_(0.125), SC_(-3.6368769959723153986096176847086544210481481846930930092672e+1) }},
+    {{ SC_(-5.25), SC_(2), SC_(6), SC_(6.48986425825943314686688089660143916795197362850165138450455e+2) }},
+    {{ SC_(1.5), SC_(0.5), SC_(2), SC_(1.5110326938313497136774585367414417050881761143075888806004e-1) }},
+    {{ SC_(2.25), SC_(-1.5), SC_(1.25), SC_(2.8615764038764359020063192215520062480578736581806142938248e-2) }},
+    {{ SC_(0.5), SC_(-3.25), SC_(5), SC_(3.25899149367128696642440271852242842699416838207250941676568e-1) }},
+    {{ SC_(3), SC_(-1), SC_(2), SC_(5.20964503526022585909775380997317054557504412613972312367263e-3) }},
+    {{ SC_(5), SC_(-1), SC_(2), SC_(6.17432325750857405600477920850423078517968051703209706611165e-5) }},
+    {{ SC_(1.5), SC_(0), SC_(4), SC_(6.62603171186832601909950661857958551791021059382949040527533e-2) }},
+    {{ SC_(-3), SC_(2.5), SC_(1.5), SC_(4.5) }},
+    {{ SC_(-6), SC_(0.5), SC_(7), SC_(5.834171875e+3) }},
+    {{ SC_(-4), SC_(-2.5), SC_(3), SC_(8.0625) }},
+    {{ SC_(2.5), SC_(1.75), SC_(0.03125), SC_(9.71106427996841789693519537663931595948326370055258257397728) }},
+    {{ SC_(0.125), SC_(4.75), SC_(0.25), SC_(1.49956839718442963643182953078320173069669917984530019951978e+2) }},
+  }};
+
+  do_test_hypergeometric_u<T>(hypergeometric_u_data, name, "Tricomi U: mpmath Data");
+
+  // the pair is only defined where 1F1 is, that is b not a non-positive integer
+  static const boost::array<boost::array<T, 4>, 21> hypergeometric_1f1_and_u_data = {{
+    {{ SC_(0.5), SC_(1.5), SC_(2), SC_(7.0710678118654752440084436210484903928483593768847403658834e-1) }},
+    {{ SC_(1.25), SC_(2.5), SC_(0.75), SC_(1.78691301094948153738684517828744429931043870629620324243446) }},
+    {{ SC_(2.5), SC_(3.25), SC_(10), SC_(2.99757245646829316098629391811485790788854444059199268640678e-3) }},
+    {{ SC_(3), SC_(4.5), SC_(1), SC_(1.9565690683118240463939661674624703384022047329957233985816) }},
+    {{ SC_(0.25), SC_(1), SC_(3.5), SC_(7.20119652700636752318476115254994548647263238906516854534869e-1) }},
+    {{ SC_(1), SC_(1), SC_(1), SC_(5.96347362323194074341078499369279376074177860152548781573485e-1) }},
+    {{ SC_(7.5), SC_(2.25), SC_(4), SC_(1.35977812291700535447083314373156002424758377775080693520064e-7) }},
+    {{ SC_(0.75), SC_(5.5), SC_(30), SC_(8.59438701133687618624162925544845288852357886098428714606058e-2) }},
+    {{ SC_(1.5), SC_(2.5), SC_(150), SC_(5.44331053951817355154952016601309198214654995701482250762821e-4) }},
+    {{ SC_(4), SC_(1.5), SC_(200), SC_(5.83582849751650620568602476119986379805980538051836114887479e-10) }},
+    {{ SC_(-2.5), SC_(1.5), SC_(3), SC_(-4.97964607176052221889140823182938305496056510470484430566045) }},
+    {{ SC_(-0.75), SC_(3.25), SC_(0.125), SC_(-3.6368769959723153986096176847086544210481481846930930092672e+1) }},
+    {{ SC_(-5.25), SC_(2), SC_(6), SC_(6.48986425825943314686688089660143916795197362850165138450455e+2) }},
+    {{ SC_(1.5), SC_(0.5), SC_(2), SC_(1.5110326938313497136774585367414417050881761143075888806004e-1) }},
+    {{ SC_(2.25), SC_(-1.5), SC_(1.25), SC_(2.8615764038764359020063192215520062480578736581806142938248e-2) }},
+    {{ SC_(0.5), SC_(-3.25), SC_(5), SC_(3.25899149367128696642440271852242842699416838207250941676568e-1) }},
+    {{ SC_(-3), SC_(2.5), SC_(1.5), SC_(4.5) }},
+    {{ SC_(-6), SC_(0.5), SC_(7), SC_(5.834171875e+3) }},
+    {{ SC_(-4), SC_(-2.5), SC_(3), SC_(8.0625) }},
+    {{ SC_(2.5), SC_(1.75), SC_(0.03125), SC_(9.71106427996841789693519537663931595948326370055258257397728) }},
+    {{ SC_(0.125), SC_(4.75), SC_(0.25), SC_(1.49956839718442963643182953078320173069669917984530019951978e+2) }},
+  }};
+
+  do_test_hypergeometric_1f1_and_u<T>(hypergeometric_1f1_and_u_data, name, "Tricomi U with 1F1: mpmath Data");
+
+  test_hypergeometric_u_closed_forms(T(0));
+  test_hypergeometric_1f1_and_u_consistency(T(0));
+}
@@ -0,0 +1,102 @@
+//  (C) Copyright Anton Bikineev 2014.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/debug_adaptor.hpp>
+#include <boost/math/tools/inplace_arithmetic.hpp>
+#include <boost/math/special_functions/hypergeometric.hpp>
+#include <boost/static_assert.hpp>
+#include <iostream>
+
+//
+// DESCRIPTION:
+// ~~~~~~~~~~~~
+//
+// This file tests that the in-place paths of the kernels listed in
+// boost/math/tools/inplace_arithmetic.hpp give the results of their
+// expressions bit for bit. debug_adaptor over cpp_dec_float has the
+// arithmetic of cpp_dec_float, with inplace_arithmetic switched off
+// below it takes the expressions.
+//
+
+typedef boost::multiprecision::number<boost::multiprecision::cpp_dec_float<50>, boost::multiprecision::et_off> inplace_type;
+typedef boost::multiprecision::number<boost::multiprecision::debug_adaptor<boost::multiprecision::cpp_dec_float<50> >, boost::multiprecision::et_off> expression_type;
+
+namespace boost { namespace math { namespace tools {
+
+template <>
+struct inplace_arithmetic<expression_type>: boost::mpl::false_ {};
+
+} } } // namespaces
+
+BOOST_STATIC_ASSERT(boost::math::tools::inplace_arithmetic<inplace_type>::value);
+BOOST_STATIC_ASSERT(!boost::math::tools::inplace_arithmetic<expression_type>::value);
+
+typedef boost::math::policies::policy<> policy_type;
+
+template <class T>
+T series_1f1() { return boost::math::detail::hypergeometric_1f1_generic_series(T(-7.25), T(3.5), T(11.5), policy_type()); }
+
+template <class T>
+T series_0f1() { return boost::math::detail::hypergeometric_0f1_generic_series(T(2.5), T(-40), policy_type()); }
+
+template <class T>
+T series_1f0() { return boost::math::detail::hypergeometric_1f0_generic_series(T(2.5), T(0.3), policy_type()); }
+
+template <class T>
+T series_1f2() { return boost::math::detail::hypergeometric_1f2_generic_series(T(1.5), T(2.25), T(3.5), T(-30), policy_type()); }
+
+template <class T>
+T series_2f0() { return boost::math::detail::hypergeometric_2f0_generic_series(T(-6), T(1.5), T(0.25), policy_type()); }
+
+template <class T>
+T series_2f1() { return boost::math::detail::hypergeometric_2f1_generic_series(T(1.5), T(2.25), T(3.75), T(0.75), policy_type()); }
+
+template <class T>
+T rational_1f1() { return boost::math::detail::hypergeometric_1f1_rational(T(126.98), T(350.5), T(7.5), policy_type()); }
+
+template <class T>
+T pade_1f1() { return boost::math::detail::hypergeometric_1f1_pade(T(-38.5), T(-80.25), policy_type()); }
+
+template <class T>
+T recurrence_backward()
+{
+  boost::math::detail::hypergeometric_1f1_recurrence_a_coefficients<T> coefficients(T(-0.25), T(3.5), T(2.5));
+  return boost::math::tools::solve_recurrence_relation_backward(coefficients, 100u, T(1.1875), T(1.25));
+}
+
+template <class T>
+T recurrence_forward()
+{
+  boost::math::detail::hypergeometric_1f1_recurrence_b_coefficients<T> coefficients(T(0.1), T(0.2), T(5));
+  return boost::math::tools::solve_recurrence_relation_forward(coefficients, 200u, T(1.25), T(1.1875));
+}
+
+template <class T>
+T public_1f1() { return boost::math::hypergeometric_1f1(T(-20.5), T(3.25), T(15.5)); }
+
+void check_bit_identical(const inplace_type& inplace, const expression_type& expression, const char* kernel)
+{
+  std::cout << "Testing the in-place path of " << kernel << "\n";
+  BOOST_CHECK_MESSAGE(inplace.backend().compare(expression.backend().value()) == 0,
+    kernel << ": " << inplace.str(0, std::ios_base::scientific) << " != " << expression.str(0, std::ios_base::scientific));
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+  check_bit_identical(series_1f1<inplace_type>(), series_1f1<expression_type>(), "the 1F1 series");
+  check_bit_identical(series_0f1<inplace_type>(), series_0f1<expression_type>(), "the 0F1 series");
+  check_bit_identical(series_1f0<inplace_type>(), series_1f0<expression_type>(), "the 1F0 series");
+  check_bit_identical(series_1f2<inplace_type>(), series_1f2<expression_type>(), "the 1F2 series");
+  check_bit_identical(series_2f0<inplace_type>(), series_2f0<expression_type>(), "the 2F0 series");
+  check_bit_identical(series_2f1<inplace_type>(), series_2f1<expression_type>(), "the 2F1 series");
+  check_bit_identical(rational_1f1<inplace_type>(), rational_1f1<expression_type>(), "Luke's rational approximation");
+  check_bit_identical(pade_1f1<inplace_type>(), pade_1f1<expression_type>(), "Luke's Pade approximation");
+  check_bit_identical(recurrence_backward<inplace_type>(), recurrence_backward<expression_type>(), "the backward recurrence");
+  check_bit_identical(recurrence_forward<inplace_type>(), recurrence_forward<expression_type>(), "the forward recurrence");
+  check_bit_identical(public_1f1<inplace_type>(), public_1f1<expression_type>(), "hypergeometric_1f1");
+}
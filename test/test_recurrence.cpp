@@ -0,0 +1,315 @@
+//  (C) Copyright Anton Bikineev 2014.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/math/special_functions/hypergeometric.hpp>
+#include <boost/math/tools/recurrence.hpp>
+#include <iostream>
+#include <vector>
+#include "table_type.hpp"
+
+#ifndef SC_
+#  define SC_(x) static_cast<typename table_type<T>::type>(BOOST_JOIN(x, L))
+#endif
+
+//
+// DESCRIPTION:
+// ~~~~~~~~~~~~
+//
+// This file tests the three-term recurrence solvers of
+// boost/math/tools/recurrence.hpp on the recurrence of the Bessel
+// functions, whose solutions J and Y are minimal and dominant in
+// turn, and on that of 1F1 in b, against the functions themselves;
+// Miller's algorithm with either kind of normalization, and the
+// parallel solvers against the serial ones.
+//
+
+// J(v0 + sn, x) and Y(v0 + sn, x) as w(n): w(n + 1) - 2v / x w(n) + w(n - 1) = 0
+// with v the order at the centre, which is n = k + 1 for the forward
+// solvers and n = k - 1 for the backward ones
+template <class T>
+struct bessel_recurrence_coefficients
+{
+  typedef boost::math::tuple<T, T, T> result_type;
+
+  bessel_recurrence_coefficients(const T& v0, const T& x, int s, int centre): v0(v0), x(x), s(s), centre(centre)
+  {
+  }
+
+  result_type operator()(boost::intmax_t k) const
+  {
+    const T v = v0 + s * (k + centre);
+    return result_type(T(1), T((2 * v) / x), T(1));
+  }
+
+private:
+  const T v0, x;
+  const int s, centre;
+};
+
+// J(0, x) + 2 J(2, x) + 2 J(4, x) + ... == 1, the normalization
+// of Miller's algorithm for the Bessel functions of integer order
+template <class T>
+struct bessel_j_sum_normalization
+{
+  typedef T value_type;
+
+  T operator()(boost::uintmax_t n) const { return (n == 0u) ? T(1) : ((n & 1u) ? T(0) : T(2)); }
+  T sum() const { return T(1); }
+};
+
+// w(k + 2) = 2 w(k + 1) for k < half, w(k + 2) = w(k + 1) / 2 after:
+// the solution leaves the range of double on the way and comes back
+// to w(1), exactly, as all steps are powers of two
+template <class T>
+struct up_and_down_coefficients
+{
+  typedef boost::math::tuple<T, T, T> result_type;
+
+  explicit up_and_down_coefficients(boost::intmax_t half): half(half)
+  {
+  }
+
+  result_type operator()(boost::intmax_t k) const
+  {
+    return result_type(T(1), T((k < half) ? 2 : 0.5f), T(0));
+  }
+
+private:
+  const boost::intmax_t half;
+};
+
+template <class T>
+void check_solution(const T& value, const T& expected, const T& tolerance, boost::math::tools::recurrence_method method, const char* name)
+{
+  BOOST_MATH_STD_USING // fabs
+  std::cout << name << ": method " << static_cast<int>(method) << ", relative error "
+            << fabs((value - expected) / expected) / boost::math::tools::epsilon<T>() << " epsilon" << std::endl;
+  BOOST_CHECK_CLOSE_FRACTION(value, expected, tolerance);
+}
+
+template <class T>
+void test_recurrence(T, const char* type_name)
+{
+  using namespace boost::math::tools;
+
+  std::cout << "Testing the recurrence solvers with type " << type_name
+    << "\n~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n";
+
+  const T eps = epsilon<T>();
+  const T v0 = T(0.25);
+  const T x = 10;
+
+  T error = 0;
+  recurrence_method method = recurrence_forward;
+
+  // Y is dominant as the order grows: plain stepping
+  {
+    bessel_recurrence_coefficients<T> coefs(v0, x, 1, 1);
+    const T result = solve_recurrence_relation(coefs, 40, boost::math::cyl_neumann(v0, x), boost::math::cyl_neumann(T(v0 + 1), x), &error, &method);
+
+    BOOST_CHECK_EQUAL(method, recurrence_forward);
+    BOOST_CHECK_EQUAL(choose_recurrence_method(coefs, 40, boost::math::cyl_neumann(v0, x), boost::math::cyl_neumann(T(v0 + 1), x)), recurrence_forward);
+    check_solution(result, T(boost::math::cyl_neumann(T(v0 + 40), x)), T(1000 * eps), method, "Y forward");
+  }
+
+  // J is minimal as the order grows: plain stepping would lose it
+  // past the turning point, Miller's or Olver's method must be taken
+  {
+    bessel_recurrence_coefficients<T> coefs(v0, x, 1, 1);
+    const T result = solve_recurrence_relation(coefs, 40, boost::math::cyl_bessel_j(v0, x), boost::math::cyl_bessel_j(T(v0 + 1), x), &error, &method);
+
+    BOOST_CHECK((method == recurrence_miller) || (method == recurrence_olver));
+    BOOST_CHECK_EQUAL(choose_recurrence_method(coefs, 40, boost::math::cyl_bessel_j(v0, x), boost::math::cyl_bessel_j(T(v0 + 1), x)), method);
+    check_solution(result, T(boost::math::cyl_bessel_j(T(v0 + 40), x)), T(1000 * eps), method, "J forward");
+  }
+
+  // J with w(1) off by 100 epsilon: the seeds must own up to their error
+  // to be taken for the minimal solution, stepping on them instead says
+  // what it loses; the decision is made where the roots part, near order x
+  {
+    bessel_recurrence_coefficients<T> coefs(v0, x, 1, 1);
+    const T first = boost::math::cyl_bessel_j(v0, x);
+    const T second = boost::math::cyl_bessel_j(T(v0 + 1), x) * (1 + 100 * eps);
+
+    solve_recurrence_relation(coefs, 40, first, second, &error, &method);
+    BOOST_CHECK_EQUAL(method, recurrence_forward);
+    BOOST_CHECK(error > 1);
+
+    const T result = solve_recurrence_relation(coefs, 40, first, second, &error, &method, static_cast<T*>(0), T(128 * eps));
+    BOOST_CHECK_EQUAL(method, recurrence_miller);
+    BOOST_CHECK_EQUAL(choose_recurrence_method(coefs, 40, first, second, T(128 * eps)), recurrence_miller);
+    check_solution(result, T(boost::math::cyl_bessel_j(T(v0 + 40), x)), T(1000 * eps), method, "J forward, inexact seeds");
+
+    T previous = 0;
+    solve_recurrence_relation(coefs, 40, first, second, &error, &method, &previous, T(128 * eps));
+    BOOST_CHECK_CLOSE_FRACTION(previous, T(boost::math::cyl_bessel_j(T(v0 + 39), x)), T(1000 * eps));
+  }
+
+  // the negative index, with the order falling from v0 + 40 as the index
+  // does: J is dominant that way
+  {
+    const T top = v0 + 40;
+    bessel_recurrence_coefficients<T> coefs(top, x, 1, -1);
+    const T result = solve_recurrence_relation(coefs, -20, boost::math::cyl_bessel_j(top, x), boost::math::cyl_bessel_j(T(top - 1), x), &error, &method);
+
+    BOOST_CHECK_EQUAL(method, recurrence_backward);
+    check_solution(result, T(boost::math::cyl_bessel_j(T(v0 + 20), x)), T(1000 * eps), method, "J backward");
+  }
+
+  // the negative index, with the order growing from v0 as the index
+  // falls: J is minimal that way
+  {
+    bessel_recurrence_coefficients<T> coefs(v0, x, -1, -1);
+    const T result = solve_recurrence_relation(coefs, -40, boost::math::cyl_bessel_j(v0, x), boost::math::cyl_bessel_j(T(v0 + 1), x), &error, &method);
+
+    BOOST_CHECK((method == recurrence_miller) || (method == recurrence_olver));
+    check_solution(result, T(boost::math::cyl_bessel_j(T(v0 + 40), x)), T(1000 * eps), method, "J backward, minimal");
+  }
+
+  // 1F1(a, b, z) down from a = 0 to a = -12: the roots are apart at the
+  // start and w(-1) / w(0) is close to the smaller one, yet the terminating
+  // series is not the minimal solution, which Miller's and Olver's method
+  // would find instead; value calculated with mpmath
+  {
+    const T b = SC_(-0.8847300000000000164135371960583142936229705810546875);
+    const T z = SC_(59.51899999999999835154085303656756877899169921875);
+
+    boost::math::detail::hypergeometric_1f1_recurrence_a_coefficients<T> coefs(T(-1), b, z);
+    const T result = solve_recurrence_relation(coefs, -12, T(1), T(1 - z / b), &error, &method);
+
+    BOOST_CHECK_EQUAL(method, recurrence_backward);
+    check_solution(result, T(SC_(-2.9405676494548546091608850201329245837276945452375577215971e+14)), T(1000 * eps), method, "terminating 1F1 backward");
+  }
+
+  // 1F1(a, b, z) down from a = -0.815 to a = -27.815: the roots are apart
+  // at the start and together from some way down on, where the solutions
+  // oscillate for good; Olver's forward pass would never stop there
+  {
+    const T b = SC_(-4.618);
+    const T z = SC_(35.155);
+
+    boost::math::detail::hypergeometric_1f1_recurrence_a_coefficients<T> coefs(T(SC_(-1.815)), b, z);
+    solve_recurrence_relation(coefs, -27, T(boost::math::hypergeometric_1f1(T(SC_(-0.815)), b, z)), T(boost::math::hypergeometric_1f1(T(SC_(-1.815)), b, z)), &error, &method);
+
+    BOOST_CHECK_EQUAL(method, recurrence_backward);
+  }
+
+  // Olver's method for J, storing the forward pass or keeping checkpoints
+  // of it only: the steps are the same, and so are the results to the bit
+  {
+    bessel_recurrence_coefficients<T> coefs(v0, x, 1, 0);
+    const T stored = solve_recurrence_relation_by_olver(coefs, eps, 40u, T(boost::math::cyl_bessel_j(v0, x)));
+    const T checkpointed = solve_recurrence_relation_by_olver_checkpointed(coefs, eps, 40u, T(boost::math::cyl_bessel_j(v0, x)));
+
+    BOOST_CHECK_EQUAL(checkpointed, stored);
+    check_solution(stored, T(boost::math::cyl_bessel_j(T(v0 + 40), x)), T(1000 * eps), recurrence_olver, "J by Olver");
+  }
+
+  // 1F1(0.1, 0.2 + n, 5) up to n = 10^6: in double the forward pass comes
+  // close to overflow and restarts, and the product p(i - 1) p(i) of its
+  // truncation estimate overflowed long before that, which read as
+  // converged and ran past the end of the stored steps; the tolerance is
+  // the rounding of 10^6 steps; value calculated with mpmath
+  {
+    boost::math::detail::hypergeometric_1f1_recurrence_b_coefficients<T> coefs(T(SC_(0.1)), T(SC_(0.2)), T(5));
+    const T initial = boost::math::hypergeometric_1f1(T(SC_(0.1)), T(SC_(0.2)), T(5));
+
+    const T stored = solve_recurrence_relation_by_olver(coefs, eps, 1000000u, initial);
+    const T checkpointed = solve_recurrence_relation_by_olver_checkpointed(coefs, eps, 1000000u, initial);
+
+    BOOST_CHECK_EQUAL(checkpointed, stored);
+    check_solution(stored, T(SC_(1.0000005000012750029075547232671343303329723949888)), T(2000 * eps), recurrence_olver, "1F1 by Olver, 10^6 steps");
+  }
+
+  // Miller's algorithm for J, normalized by a known value or by a sum,
+  // for the whole range w(0), ..., w(N) or for w(N) alone
+  {
+    bessel_recurrence_coefficients<T> coefs(v0, x, 1, 1);
+
+    boost::uintmax_t max_terms = 1000u;
+    std::vector<T> range;
+    solve_recurrence_relation_by_miller(coefs, 40u, recurrence_value_normalization<T>(boost::math::cyl_bessel_j(v0, x)), std::back_inserter(range), max_terms);
+
+    BOOST_CHECK_EQUAL(range.size(), 41u);
+    BOOST_CHECK((max_terms > 0u) && (max_terms < 1000u));
+    for (unsigned n = 0u; n < range.size(); ++n)
+      BOOST_CHECK_CLOSE_FRACTION(range[n], T(boost::math::cyl_bessel_j(T(v0 + n), x)), T(1000 * eps));
+
+    max_terms = 1000u;
+    const T result = solve_recurrence_relation_by_miller(coefs, 40u, recurrence_value_normalization<T>(boost::math::cyl_bessel_j(T(v0 + 5), x), 5u), max_terms);
+    check_solution(result, T(boost::math::cyl_bessel_j(T(v0 + 40), x)), T(1000 * eps), recurrence_miller, "J by Miller, w(5) known");
+
+    bessel_recurrence_coefficients<T> integer_coefs(T(0), x, 1, 1);
+    max_terms = 1000u;
+    range.clear();
+    solve_recurrence_relation_by_miller(integer_coefs, 30u, bessel_j_sum_normalization<T>(), std::back_inserter(range), max_terms);
+
+    for (unsigned n = 0u; n < range.size(); ++n)
+      BOOST_CHECK_CLOSE_FRACTION(range[n], T(boost::math::cyl_bessel_j(T(n), x)), T(1000 * eps));
+    check_solution(range.back(), T(boost::math::cyl_bessel_j(T(30), x)), T(1000 * eps), recurrence_miller, "J by Miller, sum normalization");
+  }
+
+  // the parallel solvers against the serial ones over 20000 steps
+  // in the oscillatory region of the Bessel functions, orders below x,
+  // where both directions are about as stable
+  {
+    const T big_x = 30000;
+    const unsigned steps = 20000u;
+
+    bessel_recurrence_coefficients<T> coefs(v0, big_x, 1, 1);
+    const T first = boost::math::cyl_neumann(v0, big_x);
+    const T second = boost::math::cyl_neumann(T(v0 + 1), big_x);
+
+    T serial_previous = 0, parallel_previous = 0;
+    const T serial = solve_recurrence_relation_forward(coefs, steps, first, second, &serial_previous);
+    const T parallel = solve_recurrence_relation_forward_parallel(coefs, steps, first, second, 4u, &parallel_previous);
+
+    check_solution(parallel, T(boost::math::cyl_neumann(T(v0 + steps), big_x)), T(2000 * eps), recurrence_forward, "Y forward in parallel");
+    BOOST_CHECK_CLOSE_FRACTION(parallel, serial, T(2000 * eps));
+    BOOST_CHECK_CLOSE_FRACTION(parallel_previous, serial_previous, T(2000 * eps));
+
+    // one thread, or too few steps a block, is the serial solution
+    BOOST_CHECK_EQUAL(solve_recurrence_relation_forward_parallel(coefs, steps, first, second, 1u), serial);
+    BOOST_CHECK_EQUAL(solve_recurrence_relation_forward_parallel(coefs, 100u, first, second, 4u), solve_recurrence_relation_forward(coefs, 100u, first, second));
+
+    const T top = v0 + steps;
+    bessel_recurrence_coefficients<T> backward_coefs(top, big_x, 1, -1);
+    const T top_first = boost::math::cyl_bessel_j(top, big_x);
+    const T top_second = boost::math::cyl_bessel_j(T(top - 1), big_x);
+
+    const T backward_serial = solve_recurrence_relation_backward(backward_coefs, steps, top_first, top_second, &serial_previous);
+    const T backward_parallel = solve_recurrence_relation_backward_parallel(backward_coefs, steps, top_first, top_second, 4u, &parallel_previous);
+
+    check_solution(backward_parallel, T(boost::math::cyl_bessel_j(v0, big_x)), T(2000 * eps), recurrence_backward, "J backward in parallel");
+    BOOST_CHECK_CLOSE_FRACTION(backward_parallel, backward_serial, T(2000 * eps));
+    BOOST_CHECK_CLOSE_FRACTION(parallel_previous, serial_previous, T(2000 * eps));
+  }
+
+  // the blocks are scaled by powers of two: a solution that passes
+  // 2^10000 on the way comes back exactly
+  {
+    up_and_down_coefficients<T> coefs(10000);
+
+    T previous = 0;
+    const T result = solve_recurrence_relation_forward_parallel(coefs, 20001u, T(0.5f), T(1), 3u, &previous);
+
+    BOOST_CHECK_EQUAL(result, T(1));
+    BOOST_CHECK_EQUAL(previous, T(2));
+  }
+
+  std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE( test_main )
+{
+  test_recurrence(0.1, "double");
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+  test_recurrence(0.1L, "long double");
+#endif
+}
@@ -0,0 +1,48 @@
+//  Copyright (c) 2014 Anton Bikineev
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This program converts the 1F1 test tables compiled into the tests
+// to the binary format of boost/math/tools/binary_test_data.hpp,
+// one file per table, with the values stored as long double
+// (or as double when run with the argument "double").
+//
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <boost/array.hpp>
+#include <boost/math/tools/binary_test_data.hpp>
+
+template <class S, class Table>
+void write_table(const Table& table, const std::string& name)
+{
+   const std::string path = name + ".bin";
+   std::ofstream ofs(path.c_str(), std::ios_base::binary);
+   boost::math::tools::write_binary_test_data<S>(ofs, table);
+   std::cout << path << ": " << table.size() << " rows" << std::endl;
+}
+
+template <class S>
+void write_tables()
+{
+   typedef long double T;
+
+#include "../test/hypergeometric_1f1_luke_rational_data.ipp"
+   write_table<S>(hypergeometric_1f1_luke_rational_data, "hypergeometric_1f1_luke_rational_data");
+#include "../test/hypergeometric_1f1_luke_pade_moderate_data.ipp"
+   write_table<S>(hypergeometric_1f1_luke_pade_moderate_data, "hypergeometric_1f1_luke_pade_moderate_data");
+#include "../test/hypergeometric_1f1_moderate_data.ipp"
+   write_table<S>(hypergeometric_1f1_moderate_data, "hypergeometric_1f1_moderate_data");
+}
+
+int main(int argc, char* argv[])
+{
+   if ((argc > 1) && (std::string(argv[1]) == "double"))
+      write_tables<double>();
+   else
+      write_tables<long double>();
+
+   return 0;
+}
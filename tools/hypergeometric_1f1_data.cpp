@@ -5,14 +5,68 @@
 //  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 // This program computes hypergeometric 1f1 function using
-// naive Taylor series at quite large internal precision -
-// 1000 decimal digits.
+// naive Taylor series at high internal precision.
 //
+// Run without arguments it asks for the parameters and evaluates
+// every point at 1000 decimal digits, as it always did.
 //
+// Run as
+//
+//   hypergeometric_1f1_data spec-file [threads]
+//
+// it generates the points described by the spec file and evaluates
+// them on a pool of threads (all hardware threads by default). Every
+// point starts at 64 decimal digits, and the working precision is
+// doubled (up to 1024 digits) until two precisions agree to the
+// requested number of digits, so that the bulk of a grid is evaluated
+// cheaply and only the points with heavy cancellation pay for 1000
+// digits. Results go to <name>.ipp and to <name>.bin, the binary format
+// of boost/math/tools/binary_test_data.hpp. Every finished point is
+// appended to <name>.checkpoint, and a run that is interrupted picks up
+// from there when it is started again with the same spec file.
+//
+// The spec file has one directive per line, # starts a comment:
+//
+//   name <identifier>                 name of the table, required
+//   digits <n>                        decimal digits wanted, default 60
+//   seed <n>                          seed of the random ranges, default 0
+//   <p> random <start> <end> <n>      n random values in [start, end)
+//   <p> periodic <start> <end> <n>    n equally spaced values from start to end
+//   <p> power <basis> <start> <end>   basis^k for k from start to end
+//   <p> values <v1> <v2> ...          the values given
+//
+// where <p> is one of a, b and z. Directives for the same parameter
+// add up, and the points are the product of the values of a, b and z.
+// As with the interactive mode, the generated values are rounded to
+// float so that they are exact in every type tested.
+//
+// Define BOOST_MATH_HYPERGEOMETRIC_1F1_DATA_CPP_BIN_FLOAT to use
+// cpp_bin_float where MPFR is not available.
+//
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
+#ifdef BOOST_MATH_HYPERGEOMETRIC_1F1_DATA_CPP_BIN_FLOAT
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#else
 #include <boost/multiprecision/mpfr.hpp>
+#endif
+#include <boost/array.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
 #include <boost/math/tools/test_data.hpp>
+#include <boost/math/tools/binary_test_data.hpp>
 #include <boost/test/included/prg_exec_monitor.hpp>
 #include <boost/math/special_functions/hypergeometric.hpp>
 
@@ -28,9 +82,331 @@ T hypergeometric_1f1_taylor_bare(const T& a, const T& b, const T& z)
    return boost::math::detail::hypergeometric_1f1_generic_series(a, b, z, pol);
 }
 
+#ifdef BOOST_MATH_HYPERGEOMETRIC_1F1_DATA_CPP_BIN_FLOAT
+template <unsigned Digits>
+struct working_type { typedef number<cpp_bin_float<Digits> > type; };
+#else
+template <unsigned Digits>
+struct working_type { typedef number<mpfr_float_backend<Digits> > type; };
+#endif
+
+//
+// Batch mode.
+//
+struct batch_spec
+{
+   batch_spec() : digits(60u), seed(0u) {}
+
+   std::string name;
+   unsigned digits;
+   unsigned seed;
+   std::vector<std::string> parameters[3];
+   std::vector<std::string> description;
+};
+
+// the exact decimal value of a float
+std::string exact_string(const float x)
+{
+   char buffer[128];
+   std::sprintf(buffer, "%.60e", static_cast<double>(x));
+   return buffer;
+}
+
+void add_parameter_values(batch_spec& spec, boost::random::mt19937& gen, std::istringstream& line, const std::string& parameter)
+{
+   std::vector<std::string>& values = spec.parameters[parameter == "a" ? 0 : (parameter == "b" ? 1 : 2)];
+   std::string kind;
+   line >> kind;
+
+   if (kind == "values")
+   {
+      std::string value;
+      while (line >> value)
+         values.push_back(value);
+      return;
+   }
+
+   float start, end, third;
+   if (!(line >> start >> end >> third))
+      throw std::runtime_error("Incomplete directive for parameter " + parameter + ".");
+
+   if (kind == "random")
+   {
+      boost::random::uniform_real_distribution<float> distribution(start, end);
+      for (unsigned i = 0; i < static_cast<unsigned>(third); ++i)
+         values.push_back(exact_string(distribution(gen)));
+   }
+   else if (kind == "periodic")
+   {
+      const unsigned n = static_cast<unsigned>(third);
+      for (unsigned i = 0; i < n; ++i)
+         values.push_back(exact_string(n > 1 ? start + ((end - start) * i) / (n - 1) : start));
+   }
+   else if (kind == "power")
+   {
+      for (int k = static_cast<int>(end); k <= static_cast<int>(third); ++k)
+         values.push_back(exact_string(std::pow(start, static_cast<float>(k))));
+   }
+   else
+      throw std::runtime_error("Unknown kind of values " + kind + ".");
+}
+
+batch_spec read_spec(const char* path)
+{
+   std::ifstream ifs(path);
+   if (!ifs)
+      throw std::runtime_error(std::string("Cannot open ") + path + ".");
+
+   batch_spec spec;
+   boost::random::mt19937 gen;
+   std::string text;
+
+   while (std::getline(ifs, text))
+   {
+      const std::string::size_type comment = text.find('#');
+      if (comment != std::string::npos)
+         text.erase(comment);
+
+      std::istringstream line(text);
+      std::string directive;
+      if (!(line >> directive))
+         continue;
+
+      if (directive == "name")
+         line >> spec.name;
+      else if (directive == "digits")
+         line >> spec.digits;
+      else if (directive == "seed")
+      {
+         line >> spec.seed;
+         gen.seed(spec.seed);
+      }
+      else if ((directive == "a") || (directive == "b") || (directive == "z"))
+      {
+         add_parameter_values(spec, gen, line, directive);
+         spec.description.push_back(text);
+      }
+      else
+         throw std::runtime_error("Unknown directive " + directive + ".");
+   }
+
+   if (spec.name.empty())
+      throw std::runtime_error("The spec file names no table.");
+   if (spec.parameters[0].empty() || spec.parameters[1].empty() || spec.parameters[2].empty())
+      throw std::runtime_error("The spec file has no values for some parameter.");
+
+   return spec;
+}
+
+template <unsigned Digits>
+std::string evaluate_at(const std::string& a, const std::string& b, const std::string& z)
+{
+   typedef typename working_type<Digits>::type float_type;
+
+   const float_type value = hypergeometric_1f1_taylor_bare(float_type(a), float_type(b), float_type(z));
+   return value.str(Digits, std::ios_base::scientific);
+}
+
+// whether x and y agree to the given number of decimal digits
+bool agree(const std::string& x, const std::string& y, const unsigned digits)
+{
+   typedef working_type<1024u>::type float_type;
+
+   const float_type fx(x), fy(y);
+   return abs(fx - fy) <= abs(fy) * pow(float_type(10), -static_cast<int>(digits));
+}
+
+// the value to the given digits, empty if 1024 digits were not enough
+std::string evaluate(const std::string& a, const std::string& b, const std::string& z, const unsigned digits)
+{
+   static std::string (* const tiers[])(const std::string&, const std::string&, const std::string&) =
+   {
+      &evaluate_at<64u>, &evaluate_at<128u>, &evaluate_at<256u>, &evaluate_at<512u>, &evaluate_at<1024u>
+   };
+
+   std::string previous = tiers[0](a, b, z);
+   for (unsigned i = 1; i < sizeof(tiers) / sizeof(tiers[0]); ++i)
+   {
+      const std::string current = tiers[i](a, b, z);
+      if (agree(previous, current, digits))
+         return working_type<1024u>::type(current).str(digits, std::ios_base::scientific);
+      previous = current;
+   }
+
+   return std::string();
+}
+
+struct batch_run
+{
+   const batch_spec& spec;
+   std::vector<std::string> results;
+   std::vector<char> done;
+   std::atomic<std::size_t> next;
+   std::atomic<std::size_t> finished;
+   std::mutex checkpoint_mutex;
+   std::ofstream checkpoint;
+
+   explicit batch_run(const batch_spec& spec) : spec(spec), next(0u), finished(0u) {}
+
+   std::size_t size() const
+   {
+      return spec.parameters[0].size() * spec.parameters[1].size() * spec.parameters[2].size();
+   }
+
+   void point(std::size_t i, std::string& a, std::string& b, std::string& z) const
+   {
+      const std::size_t nz = spec.parameters[2].size(), nb = spec.parameters[1].size();
+      z = spec.parameters[2][i % nz];
+      b = spec.parameters[1][(i / nz) % nb];
+      a = spec.parameters[0][i / (nz * nb)];
+   }
+
+   // checkpoint lines are "index value", with "-" for points that failed;
+   // an incomplete last line is what an interrupted run leaves behind
+   void resume(const std::string& path)
+   {
+      std::ifstream ifs(path.c_str());
+      std::string text;
+
+      while (std::getline(ifs, text) && !ifs.eof())
+      {
+         std::istringstream line(text);
+         std::size_t i;
+         std::string value;
+         if ((line >> i >> value) && (i < size()))
+         {
+            results[i] = (value == "-") ? std::string() : value;
+            if (!done[i])
+               ++finished;
+            done[i] = 1;
+         }
+      }
+   }
+
+   void work()
+   {
+      std::string a, b, z;
+      for (std::size_t i = next++; i < size(); i = next++)
+      {
+         if (done[i])
+            continue;
+
+         point(i, a, b, z);
+         std::string value;
+         try
+         {
+            value = evaluate(a, b, z, spec.digits);
+         }
+         catch (const std::exception& e)
+         {
+            std::lock_guard<std::mutex> lock(checkpoint_mutex);
+            std::cerr << "1F1(" << a << ", " << b << ", " << z << "): " << e.what() << std::endl;
+         }
+
+         std::lock_guard<std::mutex> lock(checkpoint_mutex);
+         results[i] = value;
+         done[i] = 1;
+         checkpoint << i << ' ' << (value.empty() ? std::string("-") : value) << '\n' << std::flush;
+
+         if (++finished % 1000u == 0u)
+            std::cout << finished << " of " << size() << " points" << std::endl;
+      }
+   }
+};
+
+void write_ipp(const batch_run& run, const std::vector<std::size_t>& rows)
+{
+   const batch_spec& spec = run.spec;
+   const std::string path = spec.name + ".ipp";
+   std::ofstream ofs(path.c_str());
+
+   ofs << "//  Copyright (c) 2014 Anton Bikineev\n"
+          "//  Use, modification and distribution are subject to the\n"
+          "//  Boost Software License, Version 1.0. (See accompanying file\n"
+          "//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)\n"
+          "//\n";
+   for (std::size_t i = 0; i < spec.description.size(); ++i)
+      ofs << "//  " << spec.description[i] << "\n";
+   ofs << "#ifndef SC_\n"
+          "#  define SC_(x) static_cast<T>(BOOST_JOIN(x, L))\n"
+          "#endif\n"
+          "   static const boost::array<boost::array<T, 4>, " << rows.size() << "> " << spec.name << " = {{\n";
+
+   std::string a, b, z;
+   for (std::size_t k = 0; k < rows.size(); ++k)
+   {
+      run.point(rows[k], a, b, z);
+      ofs << "      { SC_(" << a << "), SC_(" << b << "), SC_(" << z << "), SC_(" << run.results[rows[k]] << ") }"
+          << ((k + 1 < rows.size()) ? ", \n" : "\n");
+   }
+
+   ofs << "   }};\n"
+          "//#undef SC_\n\n";
+}
+
+void write_bin(const batch_run& run, const std::vector<std::size_t>& rows)
+{
+   std::vector<boost::array<long double, 4> > table(rows.size());
+
+   std::string a, b, z;
+   for (std::size_t k = 0; k < rows.size(); ++k)
+   {
+      run.point(rows[k], a, b, z);
+      table[k][0] = std::strtold(a.c_str(), 0);
+      table[k][1] = std::strtold(b.c_str(), 0);
+      table[k][2] = std::strtold(z.c_str(), 0);
+      table[k][3] = std::strtold(run.results[rows[k]].c_str(), 0);
+   }
+
+   const std::string path = run.spec.name + ".bin";
+   std::ofstream ofs(path.c_str(), std::ios_base::binary);
+   write_binary_test_data<long double>(ofs, table);
+}
+
+int batch_main(const char* spec_path, unsigned threads)
+{
+   const batch_spec spec = read_spec(spec_path);
+   batch_run run(spec);
+   run.results.resize(run.size());
+   run.done.resize(run.size(), 0);
+
+   const std::string checkpoint_path = spec.name + ".checkpoint";
+   run.resume(checkpoint_path);
+   if (run.finished)
+      std::cout << "Resuming " << spec.name << " with " << run.finished << " of " << run.size() << " points done" << std::endl;
+   run.checkpoint.open(checkpoint_path.c_str(), std::ios_base::app);
+
+   if (threads == 0)
+      threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1u;
+
+   std::vector<std::thread> pool;
+   for (unsigned t = 0; t < threads; ++t)
+      pool.push_back(std::thread(std::bind(&batch_run::work, &run)));
+   for (unsigned t = 0; t < threads; ++t)
+      pool[t].join();
+
+   std::vector<std::size_t> rows;
+   for (std::size_t i = 0; i < run.size(); ++i)
+   {
+      if (!run.results[i].empty())
+         rows.push_back(i);
+   }
+   if (rows.size() != run.size())
+      std::cerr << run.size() - rows.size() << " points failed or were not stable at 1024 digits and are left out" << std::endl;
+
+   write_ipp(run, rows);
+   write_bin(run, rows);
+   std::cout << "Wrote " << rows.size() << " points to " << spec.name << ".ipp and " << spec.name << ".bin" << std::endl;
+
+   return 0;
+}
+
 int cpp_main(int argc, char* argv[])
 {
-   typedef number<mpfr_float_backend<1000u> > float_type;
+   if (argc > 1)
+      return batch_main(argv[1], argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 0u);
+
+   typedef working_type<1000u>::type float_type;
 
    parameter_info<float_type> arg1, arg2, arg3;
    test_data<float_type> data;